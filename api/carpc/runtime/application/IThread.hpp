@@ -2,6 +2,7 @@
 
 #include "carpc/oswrappers/Thread.hpp"
 #include "carpc/runtime/comm/async/IAsync.hpp"
+#include "carpc/runtime/comm/async/Metrics.hpp"
 #include "carpc/runtime/application/Context.hpp"
 #include "carpc/runtime/application/Types.hpp"
 
@@ -9,13 +10,19 @@
 
 namespace carpc::application {
 
+   class Workers;
+
    class IThread
       : public std::enable_shared_from_this< IThread >
    {
+      // Workers act as application thread what owns them.
+      friend class Workers;
+
       public:
          using tSptr = std::shared_ptr< IThread >;
          using tWptr = std::weak_ptr< IThread >;
          using tSptrList = std::list< tSptr >;
+         using tRptr = IThread*;
 
       public:
          IThread( ) = default;
@@ -32,19 +39,64 @@ namespace carpc::application {
          virtual void shutdown( const std::string& ) = 0;
          virtual const carpc::os::Thread& thread( ) const = 0;
          virtual void dump( ) const = 0;
+         // Could be called from any thread.
+         virtual async::metrics::Snapshot metrics( ) const = 0;
 
       public:
          virtual void set_notification( const async::IAsync::ISignature::tSptr, async::IAsync::IConsumer* ) = 0;
          virtual void clear_notification( const async::IAsync::ISignature::tSptr, async::IAsync::IConsumer* ) = 0;
          virtual void clear_all_notifications( const async::IAsync::ISignature::tSptr, async::IAsync::IConsumer* ) = 0;
-         virtual bool insert_async( const async::IAsync::tSptr ) = 0;
-         virtual bool send( const async::IAsync::tSptr, const application::Context& ) = 0;
+         // Async object is passed by value: rvalue is moved to the queue without reference counting.
+         virtual bool insert_async( async::IAsync::tSptr ) = 0;
+         virtual bool send( const async::IAsync::tSptr&, const application::Context& ) = 0;
          virtual const std::size_t wd_timeout( ) const = 0;
          virtual const time_t process_started( ) const = 0;
 
       public:
          virtual const thread::ID& id( ) const = 0;
          virtual const thread::Name& name( ) const = 0;
+
+      public:
+         // Application thread what is running in current os thread or nullptr.
+         static tRptr current( );
+         // true - current os thread is a worker of application thread returned by 'current'.
+         // Worker shares context of its owner thread, but it must not change state of the owner
+         // what is accessed only by owner os thread (notifications, consumer of the queue).
+         static bool is_worker( );
+      protected:
+         // Must be set by application thread at the beginning of its loop and reset at the end.
+         static void current( tRptr );
+      private:
+         static void is_worker( const bool );
+      private:
+         static thread_local tRptr sp_current;
+         static thread_local bool s_is_worker;
    };
 
+
+
+   inline
+   IThread::tRptr IThread::current( )
+   {
+      return sp_current;
+   }
+
+   inline
+   void IThread::current( tRptr p_thread )
+   {
+      sp_current = p_thread;
+   }
+
+   inline
+   bool IThread::is_worker( )
+   {
+      return s_is_worker;
+   }
+
+   inline
+   void IThread::is_worker( const bool is_worker )
+   {
+      s_is_worker = is_worker;
+   }
+
 } // namespace carpc::application
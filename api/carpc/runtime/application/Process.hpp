@@ -1,5 +1,8 @@
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "carpc/oswrappers/Types.hpp"
 #include "carpc/oswrappers/linux/timer.hpp"
 #include "carpc/runtime/comm/service/Registry.hpp"
@@ -31,6 +34,8 @@ namespace carpc::application {
       public:
          ~Process( );
          static tSptr instance( int argc = 0, char** argv = nullptr, char** envp = nullptr );
+         // Returns already created instance without touching its reference counter.
+         static tRptr raw_instance( );
       private:
          Process( int argc, char** argv, char** envp );
          Process( const Process& ) = delete;
@@ -59,8 +64,23 @@ namespace carpc::application {
          IThread::tSptr thread( const std::string& ) const;
          IThread::tSptr current_thread( ) const;
          const IThread::tSptrList& thread_list( ) const;
+      private:
+         // Builds lookup indexes for application threads. Must be called before threads are started,
+         // because indexes are not synchronized and are not modified after that till 'stop'.
+         void index_threads( );
       private:
          IThread::tSptrList  m_thread_list;
+         // Dense registry: each application thread gets index of its position in this vector.
+         std::vector< IThread::tRptr > m_thread_registry;
+         std::unordered_map< thread::ID::VALUE_TYPE, std::size_t > m_thread_id_index;
+         std::unordered_map< std::string, std::size_t > m_thread_name_index;
+
+      public:
+         // Metrics of IPC thread (if any) and all application threads.
+         std::vector< async::metrics::Snapshot > metrics( ) const;
+         void dump_metrics( ) const;
+      private:
+         os::os_linux::timer::tID      m_metrics_timer_id;
 
       public:
          service::Registry& service_registry( );
@@ -83,6 +103,12 @@ namespace carpc::application {
 
 
 
+   inline
+   Process::tRptr Process::raw_instance( )
+   {
+      return mp_instance.get( );
+   }
+
    inline
    const process::ID& Process::id( ) const
    {
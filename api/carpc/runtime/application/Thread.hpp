@@ -2,6 +2,7 @@
 
 #include "carpc/runtime/application/IComponent.hpp"
 #include "carpc/runtime/application/ThreadBase.hpp"
+#include "carpc/runtime/application/Workers.hpp"
 
 
 
@@ -16,6 +17,23 @@ namespace carpc::application {
             std::string                m_name;
             IComponent::tCreatorVector m_component_creators;
             std::size_t                m_wd_timeout;
+            // Type of container what will be used for storing async objects before processing.
+            async::eAsyncQueueType     m_queue_type = async::eAsyncQueueType::PRIORITY;
+            // Max number of async objects stored in the queue (0 - unlimited) and
+            // behavior of the queue when this number is reached.
+            std::size_t                m_queue_capacity = 0;
+            async::eOverflowPolicy     m_overflow_policy = async::eOverflowPolicy::REJECT;
+            // How the thread waits for async objects in case if the queue is empty
+            // and number of spin iterations before parking for SPIN_PARK strategy.
+            async::eWaitStrategy       m_wait_strategy = async::eWaitStrategy::BLOCK;
+            std::size_t                m_spin_count = 1000;
+            // Max number of async objects extracted from the queue in scope of one synchronization.
+            std::size_t                m_batch_size = 1;
+            // Number of workers what process concurrent runnable and callable objects sent to
+            // the thread (0 - all async objects are processed by the thread itself).
+            // Events and not concurrent async objects are always processed by the thread itself,
+            // so components and their consumers are never accessed in parallel.
+            std::size_t                m_workers = 0;
          };
 
       public:
@@ -40,6 +58,7 @@ namespace carpc::application {
       private:
          IComponent::tSptrList                        m_components;
          IComponent::tCreatorVector                   m_component_creators;
+         std::unique_ptr< Workers >                   mp_workers = nullptr;
    };
 
 
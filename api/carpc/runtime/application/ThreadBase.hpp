@@ -12,7 +12,7 @@ namespace carpc::application {
    class ThreadBase : public IThread
    {
       public:
-         ThreadBase( const std::string&, const std::size_t );
+         ThreadBase( const std::string&, const std::size_t, const async::IAsyncQueue::Configuration& = { }, const std::size_t batch_size = 1 );
          ~ThreadBase( );
          ThreadBase( const ThreadBase& ) = delete;
          ThreadBase& operator=( const ThreadBase& ) = delete;
@@ -27,9 +27,10 @@ namespace carpc::application {
 
       private:
          void dump( ) const override;
+         async::metrics::Snapshot metrics( ) const override;
 
       private:
-         bool send( const async::IAsync::tSptr, const application::Context& ) override;
+         bool send( const async::IAsync::tSptr&, const application::Context& ) override;
 
       private:
          const thread::ID& id( ) const override final;
@@ -47,14 +48,18 @@ namespace carpc::application {
          std::size_t                   m_wd_timeout = 0;
 
       protected:
-         void notify_consumers( const async::IAsync::tSptr );
+         void notify_consumers( const async::IAsync::tSptr& );
          async::IAsync::tSptr get_async( );
+         std::size_t get_async( async::IAsyncQueue::tBatch& );
+      protected:
+         // Max number of async objects extracted from the queue and processed in one iteration.
+         std::size_t                   m_batch_size = 1;
       private:
          void set_notification( const async::IAsync::ISignature::tSptr, async::IAsync::IConsumer* ) override final;
          void clear_notification( const async::IAsync::ISignature::tSptr, async::IAsync::IConsumer* ) override final;
          void clear_all_notifications( const async::IAsync::ISignature::tSptr, async::IAsync::IConsumer* ) override final;
-         bool is_subscribed( const async::IAsync::tSptr );
-         bool insert_async( const async::IAsync::tSptr ) override final;
+         bool is_subscribed( const async::IAsync::tSptr& );
+         bool insert_async( async::IAsync::tSptr ) override final;
          const time_t process_started( ) const override final;
          async::AsyncProcessor         m_async_processor;
    };
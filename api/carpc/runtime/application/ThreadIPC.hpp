@@ -33,7 +33,7 @@ namespace carpc::application {
          void thread_loop( ) override;
 
       public:
-         bool send( const async::IAsync::tSptr, const application::Context& ) override;
+         bool send( const async::IAsync::tSptr&, const application::Context& ) override;
       private:
          SendReceive*                                 mp_send_receive;
    };
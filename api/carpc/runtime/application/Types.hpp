@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "carpc/base/common/ID.hpp"
 #include "carpc/base/common/Name.hpp"
 #include "carpc/base/common/Priority.hpp"
@@ -58,6 +60,10 @@ namespace carpc::application {
          IPC ipc_app;
 
          std::size_t wd_timout = -1;
+         // Period (seconds) of dumping metrics of all threads. 0 - disabled.
+         std::size_t metrics_period = 0;
+         // File where timeline of async objects is written when process is stopped. Empty - timeline is disabled.
+         std::string timeline_file;
          const tPriority max_priority = priority::MAX;
       };
 
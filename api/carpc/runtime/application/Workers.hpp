@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "carpc/oswrappers/Thread.hpp"
+#include "carpc/runtime/comm/async/IAsync.hpp"
+#include "carpc/runtime/application/IThread.hpp"
+
+
+
+namespace carpc::application {
+
+   /*************************
+    *
+    * 'Workers' - pool of os threads what process concurrent async objects of one application thread.
+    * All workers act as owner application thread: current thread and context inside the worker
+    * are the same as inside owner thread, so async objects sent from the worker to local context
+    * are delivered to owner thread.
+    * Workers can't subscribe on events or unsubscribe from them, synchronously call owner thread
+    * and wait for space in full queues, because owner state is accessed only by owner os thread
+    * and owner thread stops processing its queue while it joins workers (see 'IThread::is_worker').
+    * Each worker has its own deque. Async objects are distributed between deques by turns,
+    * worker takes async objects from the front of its own deque and, in case if it is empty,
+    * steals from the back of deques of other workers.
+    *
+    * **********************/
+   class Workers
+   {
+      public:
+         Workers( IThread&, const std::size_t count );
+         ~Workers( );
+         Workers( const Workers& ) = delete;
+         Workers& operator=( const Workers& ) = delete;
+
+      public:
+         bool start( );
+         // Stops and joins all workers. Async objects what are already pushed are processed before stopping.
+         void stop( );
+         bool push( const async::IAsync::tSptr& );
+         std::size_t count( ) const;
+
+      private:
+         struct Worker
+         {
+            Worker( const std::function< void( ) >& loop );
+
+            std::mutex                                mutex;
+            std::deque< async::IAsync::tSptr >        deque;
+            carpc::os::Thread                         thread;
+         };
+
+      private:
+         void worker_loop( const std::size_t index );
+         async::IAsync::tSptr pop( const std::size_t index );
+         async::IAsync::tSptr wait( const std::size_t index );
+
+      private:
+         IThread&                                     m_owner;
+         std::vector< std::unique_ptr< Worker > >     m_workers;
+         std::atomic< bool >                          m_started = false;
+         std::atomic< std::size_t >                   m_next = 0;
+         // Number of async objects in all deques. It is used for parking idle workers.
+         std::atomic< std::size_t >                   m_pending = 0;
+         std::mutex                                   m_idle_mutex;
+         std::condition_variable                      m_idle_cond_var;
+   };
+
+
+
+   inline
+   std::size_t Workers::count( ) const
+   {
+      return m_workers.size( );
+   }
+
+} // namespace carpc::application
@@ -1,5 +1,6 @@
 #include "carpc/tools/parameters/Params.hpp"
 #include "carpc/runtime/application/Process.hpp"
+#include "carpc/runtime/comm/async/Pool.hpp"
 
 #include "carpc/trace/Trace.hpp"
 #define CLASS_ABBR "MAIN"
@@ -106,6 +107,7 @@ void boot( int argc, char** argv, char** envp )
    }
 
    memory::dump( );
+   carpc::async::pool::dump( );
 }
 
 int main( int argc, char** argv, char** envp )
@@ -1,13 +1,29 @@
 #pragma once
 
 #include <atomic>
+#include <unordered_map>
+#include <vector>
 
 #include "carpc/runtime/comm/async/IAsync.hpp"
+#include "carpc/runtime/comm/async/SubscriptionIndex.hpp"
 
 
 
 namespace carpc::async {
 
+   /*************************
+    *
+    * 'AsyncConsumerMap' - collection of consumers subscribed to async objects.
+    * Implemented as open-addressing hash table (linear probing) keyed by precomputed signature hash
+    * ('ISignature::hash') and signature equivalence ('operator<'), so lookup during processing
+    * does not depend on number of subscriptions.
+    * Consumers for each signature are stored in flat vector in order of subscription.
+    * Additionally signatures are indexed by consumer and type id, so unsubscription of consumer
+    * from all signatures of some type depends only on number of its own subscriptions.
+    * Presence of signatures is published to process-wide 'SubscriptionIndex', so other threads
+    * could check subscriptions without accessing the map.
+    *
+    * **********************/
    class AsyncConsumerMap
    {
       public:
@@ -18,13 +34,35 @@ namespace carpc::async {
          using tConsumer = IAsync::IConsumer;
 
       private:
-         struct Comparator
+         using tConsumers = std::vector< IAsync::IConsumer* >;
+         struct Slot
          {
-            bool operator( )( const IAsync::ISignature::tSptr p_es1, const IAsync::ISignature::tSptr p_es2 ) const
-            { return *p_es1 < *p_es2; }
+            std::size_t                   hash = 0;
+            // nullptr - slot is empty
+            IAsync::ISignature::tSptr     p_signature = nullptr;
+            tConsumers                    consumers;
          };
-         using tConsumersSet = std::set< IAsync::IConsumer* >;
-         using tAsyncConsumersMap = std::map< const IAsync::ISignature::tSptr, tConsumersSet, Comparator >;
+         using tSlots = std::vector< Slot >;
+
+         using tSignatures = std::vector< IAsync::ISignature::tSptr >;
+         struct ConsumerKey
+         {
+            bool operator==( const ConsumerKey& other ) const
+            { return p_consumer == other.p_consumer && type_id == other.type_id; }
+
+            IAsync::IConsumer*            p_consumer = nullptr;
+            tAsyncTypeID                  type_id;
+         };
+         struct ConsumerKeyHash
+         {
+            std::size_t operator( )( const ConsumerKey& key ) const
+            { return hash_combine( std::hash< IAsync::IConsumer* >{ }( key.p_consumer ), key.type_id.hash( ) ); }
+         };
+         // Signatures (pointers to signatures stored in slots) what consumer is subscribed to.
+         using tConsumerIndex = std::unordered_map< ConsumerKey, tSignatures, ConsumerKeyHash >;
+
+         static constexpr std::size_t s_initial_slots = 16;
+         static constexpr std::size_t s_not_found = static_cast< std::size_t >( -1 );
 
       public:
          AsyncConsumerMap( const std::string& name = "NoName" );
@@ -39,21 +77,59 @@ namespace carpc::async {
          void set_notification( const IAsync::ISignature::tSptr, IAsync::IConsumer* );
          void clear_notification( const IAsync::ISignature::tSptr, IAsync::IConsumer* );
          void clear_all_notifications( const IAsync::ISignature::tSptr, IAsync::IConsumer* );
-         bool is_subscribed( const IAsync::ISignature::tSptr );
+         // Could be called from any thread.
+         bool is_subscribed( const IAsync::ISignature::tSptr& ) const;
+         // Number of signatures and number of pairs signature / consumer. Could be called from any thread.
+         std::size_t signatures( ) const;
+         std::size_t subscriptions( ) const;
+      private:
+         static bool is_equivalent( const IAsync::ISignature&, const IAsync::ISignature& );
+         static bool add_consumer( tConsumers&, IAsync::IConsumer* );
+         static bool remove_consumer( tConsumers&, IAsync::IConsumer* );
+         // Returns index of the slot with equivalent signature or 's_not_found'.
+         std::size_t find( const IAsync::ISignature& ) const;
+         // Returns index of the slot with equivalent signature. Slot is created if it does not exist.
+         std::size_t emplace( const IAsync::ISignature::tSptr );
+         void erase( const std::size_t );
+         void rehash( const std::size_t );
+         // Add / remove consumer to / from the slot and update consumer index.
+         // Slot is erased in case if it has no consumers any more.
+         void subscribe( const std::size_t, IAsync::IConsumer* );
+         void unsubscribe( const std::size_t, IAsync::IConsumer* );
       private:
-         tAsyncConsumersMap               m_map;
+         tSlots                           m_slots;
+         std::atomic< std::size_t >       m_count = 0;
+         std::atomic< std::size_t >       m_subscriptions = 0;
+         tConsumerIndex                   m_consumer_index;
+         SubscriptionIndex::tSubscriber   m_subscriber = SubscriptionIndex::s_invalid;
 
       public:
-         bool process( const IAsync::tSptr, std::atomic< time_t >& );
+         bool process( const IAsync::tSptr&, std::atomic< time_t >& );
       private:
-         bool is_processing( const IAsync::ISignature::tSptr p_signature ) const;
-      public:
-         IAsync::tSptr                    mp_processing_async = nullptr;
-         tConsumersSet                    m_consumers_to_add;
-         tConsumersSet                    m_consumers_to_remove;
+         bool is_processing( const IAsync::ISignature::tSptr& p_signature ) const;
+      private:
+         // Signature of currently processed async object. It is owned by async object what is
+         // owned by the caller of 'process' during whole processing.
+         const IAsync::ISignature*        mp_processing_signature = nullptr;
+         tConsumers                       m_consumers_to_add;
+         tConsumers                       m_consumers_to_remove;
 
       public:
          void dump( ) const;
    };
 
+
+
+   inline
+   std::size_t AsyncConsumerMap::signatures( ) const
+   {
+      return m_count.load( std::memory_order_relaxed );
+   }
+
+   inline
+   std::size_t AsyncConsumerMap::subscriptions( ) const
+   {
+      return m_subscriptions.load( std::memory_order_relaxed );
+   }
+
 } // namespace carpc::async
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "carpc/oswrappers/ConditionVariable.hpp"
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'AsyncDeadlineQueue' - queue what extracts async objects earliest deadline first (EDF).
+    * Async objects without deadline are extracted after all async objects with deadline.
+    * Async objects with equal deadlines are extracted in order of insertion.
+    * Each extracted async object what has already missed its deadline is counted.
+    * Overflow policies:
+    *    DROP_OLDEST          - the earliest inserted async object is dropped.
+    *    DROP_LOWEST_PRIORITY - async object with the latest deadline is dropped in case if
+    *                           its deadline is not earlier then deadline of inserted one.
+    * Conflation is not supported.
+    *
+    * **********************/
+   class AsyncDeadlineQueue : public IAsyncQueue
+   {
+      public:
+         using tSptr = std::shared_ptr< AsyncDeadlineQueue >;
+         using tWptr = std::weak_ptr< AsyncDeadlineQueue >;
+
+      private:
+         struct Entry
+         {
+            IAsync::tDeadline          deadline;
+            std::uint64_t              sequence;
+            IAsync::tSptr              p_async;
+         };
+         // Comparator for heap what has the entry with earliest deadline on the top.
+         struct Later
+         {
+            bool operator( )( const Entry& lhs, const Entry& rhs ) const
+            {
+               if( lhs.deadline != rhs.deadline )
+                  return lhs.deadline > rhs.deadline;
+               return lhs.sequence > rhs.sequence;
+            }
+         };
+         using tCollection = std::vector< Entry >;
+
+      public:
+         AsyncDeadlineQueue( const std::string& name = "NoName", const Configuration& configuration = { } );
+         ~AsyncDeadlineQueue( ) override;
+         AsyncDeadlineQueue( const AsyncDeadlineQueue& ) = delete;
+         AsyncDeadlineQueue& operator=( const AsyncDeadlineQueue& ) = delete;
+
+      public:
+         bool insert( IAsync::tSptr ) override;
+         IAsync::tSptr get( ) override;
+         std::size_t get_batch( tBatch&, const std::size_t ) override;
+         void clear( ) override;
+      private:
+         // Must be called under locked 'm_buffer_cond_var'.
+         IAsync::tSptr extract( const IAsync::tDeadline& now );
+         bool make_space( const IAsync::tSptr& );
+      private:
+         tCollection                   m_collection;
+         std::uint64_t                 m_sequence = 0;
+         os::ConditionVariable         m_buffer_cond_var;
+
+      public:
+         std::size_t missed( ) const;
+      private:
+         std::atomic< std::size_t >    m_missed = 0;
+
+      public:
+         void dump( ) const override;
+   };
+
+
+
+   inline
+   std::size_t AsyncDeadlineQueue::missed( ) const
+   {
+      return m_missed.load( );
+   }
+
+} // namespace carpc::async
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "carpc/oswrappers/ConditionVariable.hpp"
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
+#include "carpc/runtime/comm/async/Pool.hpp"
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'AsyncLockFreeQueue' - multi producers / single consumer queue
+    * (based on Dmitry Vyukov's non-intrusive MPSC node-based queue).
+    * Nodes are taken from the block pool ('pool::TBlockPool'): producer allocates node from
+    * its thread cache and consumer returns it to own cache, so in steady state insertion
+    * does not call the system allocator.
+    * Producers never take a lock during insertion. They only lock condition variable
+    * to wake up consumer in case if consumer is parked.
+    * Consumer parks only in case if queue is really empty.
+    * 'get' and 'clear' must be called only from consumer context "thread".
+    * Only BLOCK and REJECT overflow policies are supported, because producers can't
+    * extract async objects. Other policies are treated as REJECT.
+    *
+    * **********************/
+   class AsyncLockFreeQueue : public IAsyncQueue
+   {
+      public:
+         using tSptr = std::shared_ptr< AsyncLockFreeQueue >;
+         using tWptr = std::weak_ptr< AsyncLockFreeQueue >;
+
+      private:
+         struct Node
+         {
+            std::atomic< Node* >    p_next = nullptr;
+            IAsync::tSptr           p_async = nullptr;
+         };
+         using tNodePool = pool::TBlockPool< sizeof( Node ), alignof( Node ) >;
+
+      public:
+         AsyncLockFreeQueue( const std::string& name = "NoName", const Configuration& configuration = { } );
+         ~AsyncLockFreeQueue( ) override;
+         AsyncLockFreeQueue( const AsyncLockFreeQueue& ) = delete;
+         AsyncLockFreeQueue& operator=( const AsyncLockFreeQueue& ) = delete;
+
+      public:
+         bool insert( IAsync::tSptr ) override;
+         IAsync::tSptr get( ) override;
+         std::size_t get_batch( tBatch&, const std::size_t ) override;
+         void clear( ) override;
+      private:
+         void push( Node* );
+         Node* pop( );
+         IAsync::tSptr extract( );
+         bool reserve( );
+         void wait( );
+      private:
+         // Producers side. Points to the last inserted node.
+         alignas( 64 ) std::atomic< Node* >  mp_head;
+         // Consumer side. Points to the next node to be extracted.
+         alignas( 64 ) Node*                 mp_tail;
+         Node                                m_stub;
+
+      private:
+         std::atomic< bool >                 m_waiting = false;
+         os::ConditionVariable               m_buffer_cond_var;
+
+      public:
+         void dump( ) const override;
+   };
+
+} // namespace carpc::async
@@ -1,15 +1,22 @@
 #pragma once
 
-#include <atomic>
+#include <cstdint>
 
 #include "carpc/oswrappers/ConditionVariable.hpp"
-#include "carpc/runtime/comm/async/IAsync.hpp"
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
 
 
 
 namespace carpc::async {
 
-   class AsyncPriorityQueue
+   /*************************
+    *
+    * 'AsyncPriorityQueue' - queue with separate FIFO collection for each priority.
+    * Occupancy of collections is tracked by two level bitmap, so the highest not empty
+    * priority is found by count-leading-zeros in O(1) independently on number of priorities.
+    *
+    * **********************/
+   class AsyncPriorityQueue : public IAsyncQueue
    {
       public:
          using tSptr = std::shared_ptr< AsyncPriorityQueue >;
@@ -20,56 +27,45 @@ namespace carpc::async {
          /***************
           *
           * max_priority - max number of priorities.
-          *    Container with prioritised object will containe indexes [0; max_priority),
-          *    but real iteration will be performed from (0; max_priority).
-          *    This is because of method carpc::Tpriority::check( )
+          *    Container with prioritised object will containe indexes [0; max_priority).
+          *    Async objects with priority higher then max supported will be stored with
+          *    the highest supported priority.
           *
           **************/
-         AsyncPriorityQueue( const std::string& name = "NoName", const tPriority& max_priority = tPriority::max );
-         ~AsyncPriorityQueue( );
+         AsyncPriorityQueue(
+               const std::string& name = "NoName",
+               const tPriority& max_priority = tPriority::max,
+               const Configuration& configuration = { }
+            );
+         ~AsyncPriorityQueue( ) override;
          AsyncPriorityQueue( const AsyncPriorityQueue& ) = delete;
          AsyncPriorityQueue& operator=( const AsyncPriorityQueue& ) = delete;
 
-      private:
-         std::string                m_name;
-
       public:
-         bool insert( const IAsync::tSptr );
-         IAsync::tSptr get( );
-         void clear( );
+         bool insert( IAsync::tSptr ) override;
+         IAsync::tSptr get( ) override;
+         std::size_t get_batch( tBatch&, const std::size_t ) override;
+         void clear( ) override;
       private:
-         tCollection                m_collections;
-         os::ConditionVariable      m_buffer_cond_var;
-
-      public:
-         void freeze( );
-         void unfreeze( );
-         bool is_freezed( ) const;
+         void mark( const std::size_t );
+         void unmark( const std::size_t );
+         std::size_t highest( ) const;
+         std::size_t lowest( ) const;
+         IAsync::tSptr extract( );
+         // Must be called under locked 'm_buffer_cond_var'.
+         // Returns false in case if inserted async object should be rejected.
+         bool make_space( const std::size_t );
       private:
-         std::atomic< bool >        m_freezed = false;
+         static constexpr std::size_t s_bits = 64;
+         tCollection                   m_collections;
+         // Bit 'i' of word 'w' is set if collection with index 'w * s_bits + i' is not empty.
+         std::vector< std::uint64_t >  m_levels;
+         // Bit 'w' is set if word 'w' of 'm_levels' is not zero.
+         std::uint64_t                 m_summary = 0;
+         os::ConditionVariable         m_buffer_cond_var;
 
       public:
-         void dump( ) const;
+         void dump( ) const override;
    };
 
-
-
-   inline
-   void AsyncPriorityQueue::freeze( )
-   {
-      m_freezed.store( true );
-   }
-
-   inline
-   void AsyncPriorityQueue::unfreeze( )
-   {
-      m_freezed.store( false );
-   }
-
-   inline
-   bool AsyncPriorityQueue::is_freezed( ) const
-   {
-      return m_freezed.load( );
-   }
-
 } // namespace carpc::async
@@ -2,9 +2,9 @@
 
 #include <atomic>
 
-#include "carpc/runtime/comm/async/AsyncQueue.hpp"
-#include "carpc/runtime/comm/async/AsyncPriorityQueue.hpp"
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
 #include "carpc/runtime/comm/async/AsyncConsumerMap.hpp"
+#include "carpc/runtime/comm/async/Metrics.hpp"
 
 
 
@@ -22,12 +22,12 @@ namespace carpc::async {
     * **********************/
    class AsyncProcessor
    {
-      private:
-         using tAsyncCollection = async::AsyncPriorityQueue;
+      public:
+         using tAsyncCollection = async::IAsyncQueue;
          using tConsumerMap = async::AsyncConsumerMap;
 
       public:
-         AsyncProcessor( const std::string& );
+         AsyncProcessor( const std::string&, const tAsyncCollection::Configuration& configuration = { } );
          ~AsyncProcessor( );
          AsyncProcessor( const AsyncProcessor& ) = delete;
          AsyncProcessor& operator=( const AsyncProcessor& ) = delete;
@@ -46,20 +46,29 @@ namespace carpc::async {
          std::atomic< time_t >         m_process_started = 0;
 
       public:
+         // Must be called by owner thread before any insertion from its context.
+         void bind_consumer( );
          IAsync::tSptr get_async( );
-         bool insert_async( const IAsync::tSptr );
+         std::size_t get_async( tAsyncCollection::tBatch&, const std::size_t );
+         bool insert_async( IAsync::tSptr );
       private:
-         tAsyncCollection              m_async_queue;
+         tAsyncCollection::tSptr       mp_async_queue = nullptr;
 
       public:
-         void notify_consumers( const IAsync::tSptr );
+         void notify_consumers( const IAsync::tSptr& );
          void set_notification( const IAsync::ISignature::tSptr, IAsync::IConsumer* );
          void clear_notification( const IAsync::ISignature::tSptr, IAsync::IConsumer* );
          void clear_all_notifications( const IAsync::ISignature::tSptr, IAsync::IConsumer* );
-         bool is_subscribed( const IAsync::tSptr );
+         bool is_subscribed( const IAsync::tSptr& );
       private:
          tConsumerMap                  m_consumers_map;
 
+      public:
+         // Could be called from any thread.
+         async::metrics::Snapshot metrics( ) const;
+      private:
+         async::metrics::Collector     m_metrics;
+
       public:
          void dump( ) const;
    };
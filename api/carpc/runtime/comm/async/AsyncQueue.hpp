@@ -1,15 +1,13 @@
 #pragma once
 
-#include <atomic>
-
 #include "carpc/oswrappers/ConditionVariable.hpp"
-#include "carpc/runtime/comm/async/IAsync.hpp"
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
 
 
 
 namespace carpc::async {
 
-   class AsyncQueue
+   class AsyncQueue : public IAsyncQueue
    {
       public:
          using tSptr = std::shared_ptr< AsyncQueue >;
@@ -17,51 +15,26 @@ namespace carpc::async {
          using tCollection = std::deque< IAsync::tSptr >;
 
       public:
-         AsyncQueue( const std::string& name = "NoName" );
-         ~AsyncQueue( );
+         AsyncQueue( const std::string& name = "NoName", const Configuration& configuration = { } );
+         ~AsyncQueue( ) override;
          AsyncQueue( const AsyncQueue& ) = delete;
          AsyncQueue& operator=( const AsyncQueue& ) = delete;
 
-      private:
-         std::string                m_name;
-
       public:
-         bool insert( const IAsync::tSptr );
-         IAsync::tSptr get( );
-         void clear( );
+         bool insert( IAsync::tSptr ) override;
+         IAsync::tSptr get( ) override;
+         std::size_t get_batch( tBatch&, const std::size_t ) override;
+         void clear( ) override;
+      private:
+         // Must be called under locked 'm_buffer_cond_var'.
+         // Returns false in case if inserted async object should be rejected.
+         bool make_space( const IAsync::tSptr& );
       private:
          tCollection                m_collection;
          os::ConditionVariable      m_buffer_cond_var;
 
       public:
-         void freeze( );
-         void unfreeze( );
-         bool is_freezed( ) const;
-      private:
-         std::atomic< bool >        m_freezed = false;
-
-      public:
-         void dump( ) const;
+         void dump( ) const override;
    };
 
-
-
-   inline
-   void AsyncQueue::freeze( )
-   {
-      m_freezed.store( true );
-   }
-
-   inline
-   void AsyncQueue::unfreeze( )
-   {
-      m_freezed.store( false );
-   }
-
-   inline
-   bool AsyncQueue::is_freezed( ) const
-   {
-      return m_freezed.load( );
-   }
-
 } // namespace carpc::async
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <memory>
 
 #include "carpc/base/common/Priority.hpp"
 #include "carpc/runtime/application/Context.hpp"
+#include "carpc/runtime/comm/async/Pool.hpp"
+#include "carpc/runtime/comm/async/TAsyncPtr.hpp"
 #include "carpc/runtime/comm/async/Types.hpp"
 
 
@@ -12,10 +17,11 @@
 namespace carpc::async {
 
    class IAsync
-      : public std::enable_shared_from_this< IAsync >
    {
       public:
-         using tSptr = std::shared_ptr< IAsync >;
+         using tSptr = TAsyncPtr< IAsync >;
+         using tDeadline = std::chrono::steady_clock::time_point;
+         static constexpr tDeadline no_deadline = tDeadline::max( );
 
       public:
          struct ISignature
@@ -30,10 +36,27 @@ namespace carpc::async {
             virtual const bool from_stream( ipc::tStream& ) = 0;
 
             virtual bool operator<( const ISignature& ) const = 0;
+            // Exact comparison of two signatures. Unlike 'operator<' it must not treat any field as wildcard.
+            // By default signatures are equal in case if they are equivalent from ordering point of view.
+            virtual bool operator==( const ISignature& other ) const
+            {
+               return !( *this < other ) && !( other < *this );
+            }
 
             virtual const std::string dbg_name( ) const = 0;
 
             virtual const tAsyncTypeID& type_id( ) const = 0;
+
+            // Hash what is consistent with 'operator<': equivalent signatures must have equal hashes.
+            // It is calculated by concrete signature once when its content is defined.
+            std::size_t hash( ) const { return m_hash; }
+
+            // Identifier what links related async objects (for example request and its response)
+            // in timeline (see 'timeline::flush'). 0 - not linked.
+            virtual std::uint64_t flow_id( ) const { return 0; }
+
+            protected:
+               std::size_t m_hash = 0;
          };
 
          struct IConsumer
@@ -43,17 +66,129 @@ namespace carpc::async {
          };
 
       public:
-         IAsync( ) = default;
+         IAsync( );
          virtual ~IAsync( ) = default;
 
       public:
          virtual void process( IConsumer* p_consumer = nullptr ) const = 0;
-         virtual const ISignature::tSptr signature( ) const = 0;
+         // Returned by reference to avoid reference counting on each access.
+         virtual const ISignature::tSptr& signature( ) const = 0;
          virtual const tPriority priority( ) const = 0;
          virtual const eAsyncType type( ) const = 0;
+         // Conflated async object replaces pending async object with the equal signature
+         // in the queue instead of being appended to the queue (latest value wins).
+         virtual const bool is_conflated( ) const { return false; }
+         // Absolute time point till what async object should be processed.
+         // It is used by deadline queue for ordering async objects (earliest deadline first).
+         virtual const tDeadline deadline( ) const { return no_deadline; }
+         // Concurrent async object could be processed by any worker of destination application thread
+         // in parallel with other async objects (see 'Thread::Configuration::m_workers').
+         virtual const bool is_concurrent( ) const { return false; }
       protected:
          const bool dispatch( const application::Context& to_context );
+
+      public:
+         // Steady clock time in nanoseconds when async object has been dispatched last time.
+         // It is used for measuring of queue wait time (see 'metrics::Collector').
+         std::int64_t dispatched_ns( ) const { return m_dispatched_ns.load( std::memory_order_relaxed ); }
+      private:
+         std::atomic< std::int64_t >   m_dispatched_ns = 0;
+
+      public:
+         // Identifier of async object in timeline. 0 - timeline was disabled when object was created.
+         std::uint64_t timeline_id( ) const { return m_timeline_id; }
+      private:
+         const std::uint64_t           m_timeline_id = 0;
+
+      // reference counting
+      // Async object is owned by handles (see 'TAsyncPtr'). References are counted without atomic
+      // operations by os thread what has created async object till it is shared with other os thread.
+      public:
+         // Switches counting of references to atomic operations. It is done by application thread
+         // when async object is inserted to the queue what is processed by other os thread, but
+         // it must be done explicitly by owner os thread before passing handle to other os thread
+         // in any other way (for example captured by operation of runnable object).
+         void share( ) const;
+      protected:
+         // Pool block of async object (see 'make_async') what is owned by async object itself while
+         // at least one handle exists. It is used for shared pointers what alias parts of async object.
+         const std::shared_ptr< IAsync >& storage( ) const { return mp_storage; }
+      private:
+         template< typename > friend class TAsyncPtr;
+         template< typename T, typename ... TYPES > friend TAsyncPtr< T > make_async( TYPES&& ... );
+         void add_reference( ) const;
+         void release_reference( ) const;
+         static const void* thread_token( );
+      private:
+         mutable std::atomic< std::uint32_t >   m_references = 0;
+         // Os thread what counts references without atomic operations. nullptr - async object is shared.
+         mutable std::atomic< const void* >     mp_owner = thread_token( );
+         mutable std::shared_ptr< IAsync >      mp_storage = nullptr;
    };
 
+
+
+   /*************************
+    *
+    * 'make_async' - creates async object in the pool (see 'pool::make_shared') and returns
+    * the first handle to it. Constructor of 'T' could be private in case if 'T' declares friend:
+    *    template< typename > friend struct pool::__private__::TAllocated;
+    *
+    * **********************/
+   template< typename T, typename ... TYPES >
+   TAsyncPtr< T > make_async( TYPES&& ... args )
+   {
+      std::shared_ptr< T > p_storage = pool::make_shared< T >( std::forward< TYPES >( args )... );
+      T* p_async = p_storage.get( );
+      p_async->IAsync::mp_storage = std::move( p_storage );
+      return TAsyncPtr< T >( p_async );
+   }
+
+
+
+   inline
+   const void* IAsync::thread_token( )
+   {
+      static thread_local char s_token = 0;
+      return &s_token;
+   }
+
+   inline
+   void IAsync::share( ) const
+   {
+      mp_owner.store( nullptr, std::memory_order_relaxed );
+   }
+
+   inline
+   void IAsync::add_reference( ) const
+   {
+      if( thread_token( ) == mp_owner.load( std::memory_order_relaxed ) )
+         m_references.store( m_references.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+      else
+         m_references.fetch_add( 1, std::memory_order_relaxed );
+   }
+
+   inline
+   void IAsync::release_reference( ) const
+   {
+      std::uint32_t references = 0;
+      if( thread_token( ) == mp_owner.load( std::memory_order_relaxed ) )
+      {
+         references = m_references.load( std::memory_order_relaxed ) - 1;
+         m_references.store( references, std::memory_order_relaxed );
+      }
+      else
+      {
+         references = m_references.fetch_sub( 1, std::memory_order_acq_rel ) - 1;
+      }
+
+      if( 0 != references )
+         return;
+
+      // Async object is destroyed together with the block in case if there are no shared pointers
+      // what alias its parts.
+      std::shared_ptr< IAsync > p_storage = std::move( mp_storage );
+   }
+
 } // namespace carpc::async
 
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "carpc/oswrappers/ConditionVariable.hpp"
+#include "carpc/runtime/comm/async/IAsync.hpp"
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'IAsyncQueue' - common interface for all containers what could be used by 'AsyncProcessor'
+    * for storing 'async' objects before their processing.
+    * Insertion could be done from any context "thread" but extraction ('get') must be done
+    * only from the context "thread" what owns the queue (single consumer).
+    * Concrete implementation is selected by 'eAsyncQueueType' from 'Configuration'
+    * via 'IAsyncQueue::create' function.
+    * In case if 'capacity' is defined, behavior of full queue is defined by 'overflow_policy'.
+    * Conflated async objects (see 'IAsync::is_conflated') replace pending async object with
+    * the equal signature in place (not supported by lock-free queue).
+    *
+    * **********************/
+   class IAsyncQueue
+   {
+      public:
+         using tSptr = std::shared_ptr< IAsyncQueue >;
+         using tWptr = std::weak_ptr< IAsyncQueue >;
+         using tBatch = std::vector< IAsync::tSptr >;
+
+         struct Configuration
+         {
+            eAsyncQueueType            type = eAsyncQueueType::PRIORITY;
+            // Max number of async objects stored in the queue. 0 - unlimited.
+            std::size_t                capacity = 0;
+            eOverflowPolicy            overflow_policy = eOverflowPolicy::REJECT;
+            eWaitStrategy              wait_strategy = eWaitStrategy::BLOCK;
+            // Number of spin iterations before parking for SPIN_PARK wait strategy.
+            std::size_t                spin_count = 1000;
+         };
+
+      public:
+         static tSptr create( const std::string&, const Configuration& );
+
+      public:
+         IAsyncQueue( const std::string& name = "NoName", const Configuration& configuration = { } );
+         virtual ~IAsyncQueue( ) = default;
+         IAsyncQueue( const IAsyncQueue& ) = delete;
+         IAsyncQueue& operator=( const IAsyncQueue& ) = delete;
+
+      public:
+         const std::string& name( ) const;
+      protected:
+         std::string                m_name;
+
+      public:
+         // Queue stores passed async object, so rvalue is moved to the queue without reference counting.
+         virtual bool insert( IAsync::tSptr ) = 0;
+         virtual IAsync::tSptr get( ) = 0;
+         /***************
+          *
+          * Waits until at least one async object is available and appends to 'batch'
+          * up to 'max_count' async objects extracted from the queue in scope of single
+          * synchronization.
+          * Returns number of appended async objects.
+          *
+          **************/
+         virtual std::size_t get_batch( tBatch& batch, const std::size_t max_count ) = 0;
+         virtual void clear( ) = 0;
+         // true - pending async object could be released by other producer (replaced by conflated
+         // async object or dropped from the full queue).
+         bool is_droppable( const IAsync& ) const;
+
+      public:
+         void freeze( );
+         void unfreeze( );
+         bool is_freezed( ) const;
+      protected:
+         std::atomic< bool >        m_freezed = false;
+
+      public:
+         std::size_t size( ) const;
+         std::size_t capacity( ) const;
+         std::size_t high_watermark( ) const;
+         std::size_t rejected( ) const;
+         std::size_t dropped( ) const;
+         std::size_t conflated( ) const;
+         std::size_t wake_ups( ) const;
+         // Average and max time between insertion of async object to empty queue and
+         // moment when consumer has extracted it.
+         std::uint64_t wake_up_latency_avg_ns( ) const;
+         std::uint64_t wake_up_latency_max_ns( ) const;
+      public:
+         // Must be called by consumer before any producing from its context (owner thread calls it
+         // before creating its components) and each time before extraction.
+         void bind_consumer( );
+      protected:
+         bool is_full( ) const;
+         // Blocks producer till queue has free space.
+         // Returns false in case if producer can't be blocked (consumer context or freezed queue).
+         bool wait_for_space( );
+         void notify_space( );
+         void on_inserted( );
+         void update_high_watermark( const std::size_t );
+         void on_extracted( const std::size_t count = 1 );
+         void on_rejected( const IAsync::tSptr& );
+         void on_dropped( const IAsync::tSptr& );
+         void dump_statistics( ) const;
+      protected:
+         // Must be called by consumer before locking the queue for extraction.
+         // Spins according to wait strategy while queue is empty.
+         // Returns true in case if queue was empty, so consumer had to wait for async object.
+         bool spin_for_data( );
+         // Must be called by consumer after extraction in case if it had to wait for async object.
+         void on_woken_up( );
+         void mark_data_time( );
+      private:
+         const eWaitStrategy                 m_wait_strategy = eWaitStrategy::BLOCK;
+         const std::size_t                   m_spin_count = 0;
+         // Time when async object has been inserted to empty queue.
+         std::atomic< std::int64_t >         m_data_time_ns = 0;
+         std::atomic< std::size_t >          m_wake_ups = 0;
+         std::atomic< std::uint64_t >        m_wake_up_latency_total_ns = 0;
+         std::atomic< std::uint64_t >        m_wake_up_latency_max_ns = 0;
+      protected:
+         // Conflation helpers. Must be called under the lock what protects collection.
+         // Slots are pointers to elements of collection, so collection must not invalidate
+         // references to its elements on insertion to the end and extraction from the beginning.
+         bool try_conflate( const IAsync::tSptr& );
+         void add_conflated( IAsync::tSptr* );
+         void remove_conflated( const IAsync::tSptr* );
+         void clear_conflated( );
+      private:
+         std::vector< IAsync::tSptr* >       m_conflated_slots;
+      protected:
+         const std::size_t                   m_capacity = 0;
+         const eOverflowPolicy               m_overflow_policy = eOverflowPolicy::REJECT;
+         std::atomic< std::size_t >          m_size = 0;
+         std::atomic< std::size_t >          m_high_watermark = 0;
+         std::atomic< std::size_t >          m_rejected = 0;
+         std::atomic< std::size_t >          m_dropped = 0;
+         std::atomic< std::size_t >          m_conflated = 0;
+      private:
+         std::atomic< std::thread::id >      m_consumer_id{ };
+         std::atomic< std::size_t >          m_space_waiters = 0;
+         std::mutex                          m_space_mutex;
+         std::condition_variable             m_space_cond_var;
+
+      public:
+         virtual void dump( ) const = 0;
+   };
+
+
+
+   inline
+   const std::string& IAsyncQueue::name( ) const
+   {
+      return m_name;
+   }
+
+   inline
+   bool IAsyncQueue::is_freezed( ) const
+   {
+      return m_freezed.load( );
+   }
+
+   inline
+   std::size_t IAsyncQueue::size( ) const
+   {
+      return m_size.load( );
+   }
+
+   inline
+   std::size_t IAsyncQueue::capacity( ) const
+   {
+      return m_capacity;
+   }
+
+   inline
+   std::size_t IAsyncQueue::high_watermark( ) const
+   {
+      return m_high_watermark.load( );
+   }
+
+   inline
+   std::size_t IAsyncQueue::rejected( ) const
+   {
+      return m_rejected.load( );
+   }
+
+   inline
+   std::size_t IAsyncQueue::dropped( ) const
+   {
+      return m_dropped.load( );
+   }
+
+   inline
+   std::size_t IAsyncQueue::conflated( ) const
+   {
+      return m_conflated.load( );
+   }
+
+   inline
+   std::size_t IAsyncQueue::wake_ups( ) const
+   {
+      return m_wake_ups.load( );
+   }
+
+   inline
+   std::uint64_t IAsyncQueue::wake_up_latency_avg_ns( ) const
+   {
+      const std::size_t wake_ups = m_wake_ups.load( );
+      return 0 == wake_ups ? 0 : m_wake_up_latency_total_ns.load( ) / wake_ups;
+   }
+
+   inline
+   std::uint64_t IAsyncQueue::wake_up_latency_max_ns( ) const
+   {
+      return m_wake_up_latency_max_ns.load( );
+   }
+
+   inline
+   bool IAsyncQueue::is_full( ) const
+   {
+      return 0 != m_capacity && m_size.load( ) >= m_capacity;
+   }
+
+   inline
+   void IAsyncQueue::bind_consumer( )
+   {
+      m_consumer_id.store( std::this_thread::get_id( ), std::memory_order_relaxed );
+   }
+
+   inline
+   void IAsyncQueue::on_extracted( const std::size_t count )
+   {
+      m_size.fetch_sub( count );
+      notify_space( );
+   }
+
+} // namespace carpc::async
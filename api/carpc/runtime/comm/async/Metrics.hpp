@@ -0,0 +1,185 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "carpc/runtime/comm/async/Types.hpp"
+
+
+
+namespace carpc::async::metrics {
+
+   /*************************
+    *
+    * 'Counter' - counter what could be incremented by many threads.
+    * Each thread increments its own shard (cache line), shards are summed on read,
+    * so producers do not contend for the same cache line.
+    *
+    * **********************/
+   class Counter
+   {
+      public:
+         Counter( ) = default;
+         Counter( const Counter& ) = delete;
+         Counter& operator=( const Counter& ) = delete;
+
+      public:
+         void add( const std::uint64_t value = 1 );
+         std::uint64_t value( ) const;
+
+      private:
+         static constexpr std::size_t s_shards = 16;
+         static std::size_t shard( );
+
+         struct alignas( 64 ) Shard
+         {
+            std::atomic< std::uint64_t >  value = 0;
+         };
+         std::array< Shard, s_shards >    m_shards;
+   };
+
+
+
+   /*************************
+    *
+    * 'Histogram' - HDR-style histogram of durations in nanoseconds.
+    * Values are mapped to log-linear buckets: each power of two is split to 's_sub_buckets'
+    * linear buckets, so relative error of any percentile does not exceed 1 / 's_sub_buckets'.
+    * Values must be recorded by single thread. Reading could be done from any thread,
+    * in this case result could be a little bit behind the real values.
+    *
+    * **********************/
+   class Histogram
+   {
+      public:
+         struct Summary
+         {
+            std::uint64_t                 count = 0;
+            std::uint64_t                 mean = 0;
+            std::uint64_t                 p50 = 0;
+            std::uint64_t                 p90 = 0;
+            std::uint64_t                 p99 = 0;
+            std::uint64_t                 max = 0;
+         };
+
+      public:
+         Histogram( ) = default;
+         Histogram( const Histogram& ) = delete;
+         Histogram& operator=( const Histogram& ) = delete;
+
+      public:
+         void record( const std::uint64_t value );
+         std::uint64_t count( ) const;
+         std::uint64_t max( ) const;
+         // Lowest value of the bucket what contains requested percentile (0.0 - 100.0).
+         std::uint64_t percentile( const double ) const;
+         Summary summary( ) const;
+
+      private:
+         static constexpr std::size_t s_sub_bucket_bits = 3;
+         static constexpr std::size_t s_sub_buckets = std::size_t{ 1 } << s_sub_bucket_bits;
+         static constexpr std::size_t s_buckets = ( 64 - s_sub_bucket_bits + 1 ) * s_sub_buckets;
+         static std::size_t bucket( const std::uint64_t value );
+         static std::uint64_t lowest( const std::size_t bucket );
+
+      private:
+         std::array< std::atomic< std::uint64_t >, s_buckets > m_buckets{ };
+         std::atomic< std::uint64_t >     m_count = 0;
+         std::atomic< std::uint64_t >     m_total = 0;
+         std::atomic< std::uint64_t >     m_max = 0;
+   };
+
+
+
+   /*************************
+    *
+    * 'Snapshot' - metrics of single application thread at the moment of request.
+    *
+    * **********************/
+   struct Snapshot
+   {
+      struct Type
+      {
+         std::string                      name;
+         // Time between dispatching of async object and start of its processing.
+         Histogram::Summary               queue_wait;
+         // Time of processing of async object by all its consumers.
+         Histogram::Summary               processing;
+      };
+
+      std::string                         name;
+      std::uint64_t                       enqueued = 0;
+      std::uint64_t                       dequeued = 0;
+      std::size_t                         depth = 0;
+      std::size_t                         peak_depth = 0;
+      std::size_t                         rejected = 0;
+      std::size_t                         dropped = 0;
+      std::size_t                         signatures = 0;
+      std::size_t                         subscriptions = 0;
+      std::vector< Type >                 types;
+
+      void dump( ) const;
+   };
+
+
+
+   /*************************
+    *
+    * 'Collector' - metrics collected by 'AsyncProcessor' of single application thread.
+    * Enqueue counter is incremented by producers, all other values are recorded only by
+    * application thread what owns the collector.
+    * Histograms are created per async type id at first processing of async object with this type.
+    *
+    * **********************/
+   class Collector
+   {
+      public:
+         Collector( ) = default;
+         Collector( const Collector& ) = delete;
+         Collector& operator=( const Collector& ) = delete;
+
+      public:
+         // Could be called from any thread.
+         void on_enqueued( );
+         // Must be called only by owner thread.
+         void on_processed( const tAsyncTypeID&, const std::uint64_t queue_wait_ns, const std::uint64_t processing_ns );
+
+      public:
+         // Fills counters and per type histograms of the snapshot.
+         void fill( Snapshot& ) const;
+
+      private:
+         struct Type
+         {
+            std::string                   name;
+            Histogram                     queue_wait;
+            Histogram                     processing;
+         };
+         struct TypeHash
+         {
+            std::size_t operator( )( const tAsyncTypeID& type_id ) const { return type_id.hash( ); }
+         };
+         // Map is modified only by owner thread under the mutex, so owner thread could look up
+         // without locking and other threads lock the mutex for reading.
+         using tTypes = std::unordered_map< tAsyncTypeID, std::unique_ptr< Type >, TypeHash >;
+
+      private:
+         Counter                          m_enqueued;
+         std::atomic< std::uint64_t >     m_dequeued = 0;
+         tTypes                           m_types;
+         mutable std::mutex               m_types_mutex;
+         // Last used type to avoid map lookup in case of series of async objects with the same type.
+         const tAsyncTypeID*              mp_last_type_id = nullptr;
+         Type*                            mp_last_type = nullptr;
+   };
+
+   // Current steady clock time in nanoseconds.
+   std::int64_t now_ns( );
+
+} // namespace carpc::async::metrics
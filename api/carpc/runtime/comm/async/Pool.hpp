@@ -0,0 +1,343 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+
+namespace carpc::async::pool {
+
+   /*************************
+    *
+    * 'Statistics' - counters of single block pool.
+    * Counters are accumulated by each thread locally and are published periodically,
+    * so they could be a little bit behind the real values.
+    *
+    * **********************/
+   struct Statistics
+   {
+      Statistics( const std::size_t _block_size, const std::size_t _alignment );
+
+      const std::size_t                block_size;
+      const std::size_t                alignment;
+      // Number of blocks allocated from the system
+      std::atomic< std::size_t >       allocated = 0;
+      // Number of allocations served by the pool without the system allocator
+      std::atomic< std::size_t >       reused = 0;
+      // Number of blocks returned to the pool
+      std::atomic< std::size_t >       released = 0;
+      // Number of blocks returned to the system because the pool was full
+      std::atomic< std::size_t >       freed = 0;
+   };
+
+   // Prints statistics of all block pools used in the process.
+   void dump( );
+
+   namespace __private__ {
+
+      // Statistics are registered at first usage of the pool and are never unregistered.
+      void register_statistics( Statistics* );
+
+   }
+
+
+
+   /*************************
+    *
+    * 'TBlockPool' - pool of memory blocks with defined size and alignment.
+    * Each thread has its own cache of free blocks, so allocation and deallocation are done
+    * without any synchronization in most cases.
+    * Blocks released by one thread (usually consumer of async object) and allocated by
+    * another one (usually producer) are exchanged via common depot by batches of blocks,
+    * so the mutex of the depot is locked once per batch.
+    *
+    * **********************/
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   class TBlockPool
+   {
+      public:
+         static void* allocate( );
+         static void deallocate( void* );
+
+      private:
+         struct Node
+         {
+            Node* p_next = nullptr;
+         };
+
+         static constexpr std::size_t s_block_size = SIZE < sizeof( Node ) ? sizeof( Node ) : SIZE;
+         static constexpr std::size_t s_alignment = ALIGNMENT < alignof( Node ) ? alignof( Node ) : ALIGNMENT;
+         // Number of blocks moved between thread cache and depot at once.
+         static constexpr std::size_t s_batch_size = 64;
+         // Max number of batches stored in depot. Blocks above this limit are returned to the system.
+         static constexpr std::size_t s_depot_capacity = 64;
+
+         struct Depot
+         {
+            std::mutex                 mutex;
+            // Each item is the list of 's_batch_size' blocks
+            std::vector< Node* >       batches;
+            Statistics                 statistics{ SIZE, ALIGNMENT };
+         };
+
+         struct Cache
+         {
+            ~Cache( );
+
+            Node*                      p_head = nullptr;
+            std::size_t                count = 0;
+            // Counters what are not published to depot statistics yet
+            std::size_t                allocated = 0;
+            std::size_t                reused = 0;
+            std::size_t                released = 0;
+            std::size_t                freed = 0;
+            std::size_t                operations = 0;
+         };
+
+         static Depot& depot( );
+         static Cache& cache( );
+         // Blocks could be allocated or released by destructors of other thread local objects
+         // after the cache has been destroyed. In this case the system allocator is used directly.
+         static bool& is_cache_destroyed( );
+         // Moves 's_batch_size' blocks from the cache to the depot.
+         static void flush( Cache& );
+         static void free_list( Node*, Cache& );
+         static void publish( Cache& );
+   };
+
+
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   typename TBlockPool< SIZE, ALIGNMENT >::Depot& TBlockPool< SIZE, ALIGNMENT >::depot( )
+   {
+      // Depot is never destroyed because thread caches could be destroyed after static objects.
+      static Depot* sp_depot = [ ]( )
+      {
+         Depot* p_depot = new Depot;
+         __private__::register_statistics( &p_depot->statistics );
+         return p_depot;
+      }( );
+      return *sp_depot;
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   typename TBlockPool< SIZE, ALIGNMENT >::Cache& TBlockPool< SIZE, ALIGNMENT >::cache( )
+   {
+      thread_local Cache s_cache;
+      return s_cache;
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   bool& TBlockPool< SIZE, ALIGNMENT >::is_cache_destroyed( )
+   {
+      thread_local bool s_is_destroyed = false;
+      return s_is_destroyed;
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   TBlockPool< SIZE, ALIGNMENT >::Cache::~Cache( )
+   {
+      is_cache_destroyed( ) = true;
+      while( count >= s_batch_size )
+         flush( *this );
+      free_list( p_head, *this );
+      p_head = nullptr;
+      count = 0;
+      publish( *this );
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   void* TBlockPool< SIZE, ALIGNMENT >::allocate( )
+   {
+      if( is_cache_destroyed( ) )
+      {
+         depot( ).statistics.allocated.fetch_add( 1, std::memory_order_relaxed );
+         return ::operator new( s_block_size, std::align_val_t( s_alignment ) );
+      }
+
+      Cache& cache = TBlockPool::cache( );
+      if( nullptr == cache.p_head )
+      {
+         Depot& depot = TBlockPool::depot( );
+         std::lock_guard< std::mutex > lock( depot.mutex );
+         if( false == depot.batches.empty( ) )
+         {
+            cache.p_head = depot.batches.back( );
+            cache.count = s_batch_size;
+            depot.batches.pop_back( );
+         }
+      }
+
+      void* p_block = nullptr;
+      if( nullptr == cache.p_head )
+      {
+         p_block = ::operator new( s_block_size, std::align_val_t( s_alignment ) );
+         ++cache.allocated;
+      }
+      else
+      {
+         p_block = cache.p_head;
+         cache.p_head = cache.p_head->p_next;
+         --cache.count;
+         ++cache.reused;
+      }
+
+      if( 0 == ( ++cache.operations % 1024 ) )
+         publish( cache );
+      return p_block;
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   void TBlockPool< SIZE, ALIGNMENT >::deallocate( void* p_block )
+   {
+      if( is_cache_destroyed( ) )
+      {
+         depot( ).statistics.freed.fetch_add( 1, std::memory_order_relaxed );
+         ::operator delete( p_block, std::align_val_t( s_alignment ) );
+         return;
+      }
+
+      Cache& cache = TBlockPool::cache( );
+      Node* p_node = static_cast< Node* >( p_block );
+      p_node->p_next = cache.p_head;
+      cache.p_head = p_node;
+      ++cache.count;
+      ++cache.released;
+
+      // Cache keeps up to two batches to avoid exchanging batches with the depot on each operation
+      // in case if thread allocates and releases blocks by turns.
+      if( cache.count >= 2 * s_batch_size )
+         flush( cache );
+
+      if( 0 == ( ++cache.operations % 1024 ) )
+         publish( cache );
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   void TBlockPool< SIZE, ALIGNMENT >::flush( Cache& cache )
+   {
+      Node* p_batch = cache.p_head;
+      Node* p_last = p_batch;
+      for( std::size_t index = 1; index < s_batch_size; ++index )
+         p_last = p_last->p_next;
+      cache.p_head = p_last->p_next;
+      cache.count -= s_batch_size;
+      p_last->p_next = nullptr;
+
+      {
+         Depot& depot = TBlockPool::depot( );
+         std::lock_guard< std::mutex > lock( depot.mutex );
+         if( depot.batches.size( ) < s_depot_capacity )
+         {
+            depot.batches.push_back( p_batch );
+            p_batch = nullptr;
+         }
+      }
+
+      free_list( p_batch, cache );
+      publish( cache );
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   void TBlockPool< SIZE, ALIGNMENT >::free_list( Node* p_node, Cache& cache )
+   {
+      while( nullptr != p_node )
+      {
+         Node* p_next = p_node->p_next;
+         ::operator delete( p_node, std::align_val_t( s_alignment ) );
+         ++cache.freed;
+         p_node = p_next;
+      }
+   }
+
+   template< std::size_t SIZE, std::size_t ALIGNMENT >
+   void TBlockPool< SIZE, ALIGNMENT >::publish( Cache& cache )
+   {
+      Statistics& statistics = TBlockPool::depot( ).statistics;
+      statistics.allocated.fetch_add( cache.allocated, std::memory_order_relaxed );
+      statistics.reused.fetch_add( cache.reused, std::memory_order_relaxed );
+      statistics.released.fetch_add( cache.released, std::memory_order_relaxed );
+      statistics.freed.fetch_add( cache.freed, std::memory_order_relaxed );
+      cache.allocated = cache.reused = cache.released = cache.freed = 0;
+   }
+
+
+
+   /*************************
+    *
+    * 'TAllocator' - allocator what takes single objects from 'TBlockPool' corresponding to
+    * their size and alignment. It is intended to be used with 'std::allocate_shared', so
+    * the object and its control block are allocated as one pooled block.
+    * Arrays are allocated by standard allocator.
+    *
+    * **********************/
+   template< typename T >
+   class TAllocator
+   {
+      public:
+         using value_type = T;
+
+      public:
+         TAllocator( ) = default;
+         template< typename U >
+            TAllocator( const TAllocator< U >& ) { }
+
+      public:
+         T* allocate( const std::size_t count )
+         {
+            if( 1 == count )
+               return static_cast< T* >( TBlockPool< sizeof( T ), alignof( T ) >::allocate( ) );
+            return std::allocator< T >( ).allocate( count );
+         }
+         void deallocate( T* p_object, const std::size_t count )
+         {
+            if( 1 == count )
+               TBlockPool< sizeof( T ), alignof( T ) >::deallocate( p_object );
+            else
+               std::allocator< T >( ).deallocate( p_object, count );
+         }
+
+      public:
+         template< typename U >
+            bool operator==( const TAllocator< U >& ) const { return true; }
+         template< typename U >
+            bool operator!=( const TAllocator< U >& ) const { return false; }
+   };
+
+
+
+   namespace __private__ {
+
+      // Has public constructor required by 'std::allocate_shared', so constructors of 'T' could
+      // stay private. Such 'T' must declare it as friend.
+      template< typename T >
+      struct TAllocated : public T
+      {
+         template< typename ... TYPES >
+         TAllocated( TYPES&& ... args )
+            : T( std::forward< TYPES >( args )... )
+         { }
+      };
+
+   }
+
+   /*************************
+    *
+    * 'make_shared' - creates object with 'TAllocator', so the object and the control block of
+    * shared pointer are allocated as one pooled block.
+    * Constructor of 'T' could be private in case if 'T' declares friend:
+    *    template< typename > friend struct pool::__private__::TAllocated;
+    *
+    * **********************/
+   template< typename T, typename ... TYPES >
+   std::shared_ptr< T > make_shared( TYPES&& ... args )
+   {
+      using tAllocated = __private__::TAllocated< T >;
+      return std::allocate_shared< tAllocated >( TAllocator< tAllocated >( ), std::forward< TYPES >( args )... );
+   }
+
+} // namespace carpc::async::pool
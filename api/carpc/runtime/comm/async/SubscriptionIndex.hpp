@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'SubscriptionIndex' - process-wide index of subscriptions of all consumer maps.
+    * Each consumer map (one per application thread) is attached to the index as subscriber and
+    * gets its own bit. Signature hashes are mapped to buckets, each bucket contains bitmask of
+    * subscribers having at least one subscription with hash mapped to this bucket.
+    * Bitmask is read by any thread with single atomic load without any locking, so sender could
+    * check if destination thread has consumers without accessing consumer map of foreign thread.
+    * Collisions of buckets lead only to false positive result, so in the worst case async object
+    * is inserted into the queue of thread what does not have consumers for it (as it was without index).
+    * Modifications are done under mutex and are not supposed to be frequent.
+    *
+    * **********************/
+   class SubscriptionIndex
+   {
+      public:
+         using tSubscriber = std::size_t;
+         using tMask = std::uint64_t;
+         static constexpr tSubscriber s_max_subscribers = 64;
+         // Subscriber what could not be attached because of all bits are busy.
+         // Such subscriber is always treated as subscribed to everything.
+         static constexpr tSubscriber s_invalid = static_cast< tSubscriber >( -1 );
+
+      private:
+         SubscriptionIndex( ) = default;
+         SubscriptionIndex( const SubscriptionIndex& ) = delete;
+         SubscriptionIndex& operator=( const SubscriptionIndex& ) = delete;
+      public:
+         static SubscriptionIndex& instance( );
+
+      public:
+         tSubscriber attach( );
+         void detach( const tSubscriber );
+         // Must be called when subscriber has got the first / lost the last subscription for signature.
+         void add( const tSubscriber, const std::size_t hash );
+         void remove( const tSubscriber, const std::size_t hash );
+
+      public:
+         // Bitmask of subscribers what could have subscriptions for signature with the hash.
+         tMask subscribers( const std::size_t hash ) const;
+         bool is_subscribed( const tSubscriber, const std::size_t hash ) const;
+         // Returns true in case if at least one subscriber has not got the bit (see 's_invalid'),
+         // so empty bitmask does not mean that there are no subscriptions.
+         bool has_unindexed( ) const;
+
+      private:
+         static constexpr std::size_t s_bucket_bits = 12;
+         static constexpr std::size_t s_buckets = std::size_t{ 1 } << s_bucket_bits;
+         static std::size_t bucket( const std::size_t hash );
+
+      private:
+         std::array< std::atomic< tMask >, s_buckets >   m_masks{ };
+         std::atomic< std::size_t >                      m_unindexed = 0;
+
+         std::mutex                                      m_mutex;
+         tMask                                           m_attached = 0;
+         // Number of subscriptions of subscriber in bucket: key is 'bucket * s_max_subscribers + subscriber'.
+         std::unordered_map< std::size_t, std::size_t >  m_counts;
+   };
+
+
+
+   inline
+   std::size_t SubscriptionIndex::bucket( const std::size_t hash )
+   {
+      // Fibonacci hashing spreads hashes what differ only in high bits.
+      return static_cast< std::size_t >( ( static_cast< std::uint64_t >( hash ) * 0x9E3779B97F4A7C15ull ) >> ( 64 - s_bucket_bits ) );
+   }
+
+   inline
+   SubscriptionIndex::tMask SubscriptionIndex::subscribers( const std::size_t hash ) const
+   {
+      return m_masks[ bucket( hash ) ].load( std::memory_order_acquire );
+   }
+
+   inline
+   bool SubscriptionIndex::is_subscribed( const tSubscriber subscriber, const std::size_t hash ) const
+   {
+      if( s_invalid == subscriber )
+         return true;
+
+      return 0 != ( subscribers( hash ) & ( tMask{ 1 } << subscriber ) );
+   }
+
+   inline
+   bool SubscriptionIndex::has_unindexed( ) const
+   {
+      return 0 != m_unindexed.load( std::memory_order_acquire );
+   }
+
+} // namespace carpc::async
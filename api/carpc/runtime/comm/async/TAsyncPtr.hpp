@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'TAsyncPtr' - intrusive handle of async object.
+    * Reference counter is located inside of async object (see 'IAsync'). It is counted without
+    * atomic operations while async object is used only by os thread what has created it and
+    * atomically after async object has been shared with other os thread (see 'IAsync::share').
+    * Handle could be created from raw pointer of async object what is owned by other handle,
+    * so passing async object to the queue or to the builder function does not lock weak reference
+    * like 'shared_from_this' does.
+    * Async objects are created by 'make_async' (see 'IAsync.hpp').
+    *
+    * **********************/
+   template< typename T >
+   class TAsyncPtr
+   {
+      template< typename > friend class TAsyncPtr;
+
+      public:
+         using element_type = T;
+
+      public:
+         TAsyncPtr( ) = default;
+         TAsyncPtr( std::nullptr_t ) { }
+         explicit TAsyncPtr( T* p_object )
+            : mp_object( p_object )
+         {
+            add_reference( );
+         }
+         TAsyncPtr( const TAsyncPtr& other )
+            : mp_object( other.mp_object )
+         {
+            add_reference( );
+         }
+         TAsyncPtr( TAsyncPtr&& other ) noexcept
+            : mp_object( std::exchange( other.mp_object, nullptr ) )
+         { }
+         template< typename U, typename = std::enable_if_t< std::is_convertible_v< U*, T* > > >
+         TAsyncPtr( const TAsyncPtr< U >& other )
+            : mp_object( other.mp_object )
+         {
+            add_reference( );
+         }
+         template< typename U, typename = std::enable_if_t< std::is_convertible_v< U*, T* > > >
+         TAsyncPtr( TAsyncPtr< U >&& other ) noexcept
+            : mp_object( std::exchange( other.mp_object, nullptr ) )
+         { }
+         ~TAsyncPtr( )
+         {
+            release_reference( );
+         }
+
+      public:
+         // Source handle is copied or moved to the parameter, so assignment of the last handle
+         // to itself does not destroy async object.
+         TAsyncPtr& operator=( TAsyncPtr other ) noexcept
+         {
+            swap( other );
+            return *this;
+         }
+         void swap( TAsyncPtr& other ) noexcept
+         {
+            std::swap( mp_object, other.mp_object );
+         }
+         void reset( )
+         {
+            TAsyncPtr( ).swap( *this );
+         }
+
+      public:
+         T* get( ) const { return mp_object; }
+         T& operator*( ) const { return *mp_object; }
+         T* operator->( ) const { return mp_object; }
+         explicit operator bool( ) const { return nullptr != mp_object; }
+
+      private:
+         void add_reference( ) const
+         {
+            if( nullptr != mp_object )
+               mp_object->add_reference( );
+         }
+         void release_reference( ) const
+         {
+            if( nullptr != mp_object )
+               mp_object->release_reference( );
+         }
+
+      private:
+         T* mp_object = nullptr;
+   };
+
+
+
+   template< typename T, typename U >
+   bool operator==( const TAsyncPtr< T >& p_lhs, const TAsyncPtr< U >& p_rhs )
+   {
+      return p_lhs.get( ) == p_rhs.get( );
+   }
+
+   template< typename T, typename U >
+   bool operator!=( const TAsyncPtr< T >& p_lhs, const TAsyncPtr< U >& p_rhs )
+   {
+      return p_lhs.get( ) != p_rhs.get( );
+   }
+
+   template< typename T >
+   bool operator==( const TAsyncPtr< T >& p_async, std::nullptr_t )
+   {
+      return nullptr == p_async.get( );
+   }
+
+   template< typename T >
+   bool operator==( std::nullptr_t, const TAsyncPtr< T >& p_async )
+   {
+      return nullptr == p_async.get( );
+   }
+
+   template< typename T >
+   bool operator!=( const TAsyncPtr< T >& p_async, std::nullptr_t )
+   {
+      return nullptr != p_async.get( );
+   }
+
+   template< typename T >
+   bool operator!=( std::nullptr_t, const TAsyncPtr< T >& p_async )
+   {
+      return nullptr != p_async.get( );
+   }
+
+   template< typename T, typename U >
+   TAsyncPtr< T > static_pointer_cast( const TAsyncPtr< U >& p_async )
+   {
+      return TAsyncPtr< T >( static_cast< T* >( p_async.get( ) ) );
+   }
+
+} // namespace carpc::async
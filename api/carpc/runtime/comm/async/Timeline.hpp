@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "carpc/runtime/comm/async/IAsync.hpp"
+
+
+
+/*************************
+ *
+ * Timeline of async objects.
+ * Stages of async object lifecycle are recorded with monotonic timestamps into ring buffer
+ * of the thread where the stage has happened. Each thread writes only to its own buffer without
+ * any locking, so older records are overwritten in case if buffer is full.
+ * Recorded stages could be written to the file in Chrome trace event format (JSON) what could be
+ * opened by 'chrome://tracing' or 'ui.perfetto.dev'. Stages of the same async object are linked by
+ * flow arrows as well as async objects with the same 'ISignature::flow_id' (request and response).
+ * Timeline is disabled by default. Only async objects created while timeline is enabled are recorded.
+ *
+ * **********************/
+namespace carpc::async::timeline {
+
+   enum class eStage : std::uint8_t
+   {
+      CREATE,
+      DISPATCH,
+      INSERT,
+      GET,
+      PROCESS_BEGIN,
+      PROCESS_END,
+      IPC_SEND,
+      IPC_RECEIVE,
+   };
+   const char* c_str( const eStage );
+
+   namespace __private__ {
+
+      std::atomic< bool >& enabled( );
+      void record( const eStage, const IAsync& );
+
+   }
+
+   void enable( const bool );
+
+   inline bool is_enabled( )
+   {
+      return __private__::enabled( ).load( std::memory_order_relaxed );
+   }
+
+   // Returns new timeline id for async object and records its creation.
+   // Returns 0 in case if timeline is disabled.
+   std::uint64_t on_created( );
+
+   inline void record( const eStage stage, const IAsync& async )
+   {
+      if( is_enabled( ) && 0 != async.timeline_id( ) )
+         __private__::record( stage, async );
+   }
+
+   // Writes records of all threads to the file in Chrome trace event format.
+   // Could be called from any thread while other threads are recording.
+   bool flush( const std::string& file_name );
+   // Drops all records what are recorded till this moment.
+   void clear( );
+
+} // namespace carpc::async::timeline
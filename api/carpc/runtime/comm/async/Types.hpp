@@ -47,6 +47,10 @@ namespace __private_carpc_async_v1__ {
          {
             return m_value < type_id.m_value;
          }
+         std::size_t hash( ) const
+         {
+            return std::hash< TYPE >{ }( m_value );
+         }
 
       public:
          const bool to_stream( carpc::ipc::tStream& stream ) const
@@ -265,10 +269,42 @@ namespace carpc::async {
    using tAsyncTypeID = __private_carpc_async_v1__::TAsyncTypeID< std::size_t >;
    // using tAsyncTypeID = __private_carpc_async_v1__::TAsyncTypeID< std::string >;
 
+   // Mixes 'value' into 'seed'. Used for building signature hashes from hashes of their fields.
+   inline std::size_t hash_combine( const std::size_t seed, const std::size_t value )
+   {
+      return seed ^ ( value + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 ) );
+   }
+
    enum class eAsyncType : std::uint8_t { EVENT, RUNNABLE, CALLABLE };
    const char* c_str( const eAsyncType );
    const char* name( const eAsyncType );
 
+   // Type of the container what is used by application thread for storing 'async' objects:
+   //    FIFO        - single mutex protected queue.
+   //    PRIORITY    - mutex protected queue with separate collection for each priority.
+   //    LOCK_FREE   - lock-free multi producers / single consumer queue.
+   //    DEADLINE    - mutex protected queue what extracts async objects earliest deadline first.
+   enum class eAsyncQueueType : std::uint8_t { FIFO, PRIORITY, LOCK_FREE, DEADLINE };
+   const char* c_str( const eAsyncQueueType );
+
+   // Behavior of the queue what has reached its capacity:
+   //    BLOCK                - producer is blocked till consumer extracts some async object.
+   //    REJECT               - inserted async object is rejected ('insert' returns false).
+   //    DROP_OLDEST          - the oldest stored async object is dropped
+   //                           (priority queue drops the oldest one with the same priority if any).
+   //    DROP_LOWEST_PRIORITY - the oldest async object with the lowest priority is dropped in case if
+   //                           its priority is not higher then priority of inserted one, otherwise
+   //                           inserted one is rejected.
+   enum class eOverflowPolicy : std::uint8_t { BLOCK, REJECT, DROP_OLDEST, DROP_LOWEST_PRIORITY };
+   const char* c_str( const eOverflowPolicy );
+
+   // Behavior of consumer what is waiting for async object in empty queue:
+   //    BLOCK       - consumer is parked on condition variable immediately.
+   //    SPIN_PARK   - consumer spins for defined number of iterations and then is parked.
+   //    BUSY_POLL   - consumer spins till async object is inserted (never parked).
+   enum class eWaitStrategy : std::uint8_t { BLOCK, SPIN_PARK, BUSY_POLL };
+   const char* c_str( const eWaitStrategy );
+
 } // namespace carpc::async
 
 
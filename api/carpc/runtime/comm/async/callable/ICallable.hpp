@@ -12,7 +12,7 @@ namespace carpc::async {
       : public IAsync
    {
       public:
-         using tSptr = std::shared_ptr< ICallable >;
+         using tSptr = TAsyncPtr< ICallable >;
 
       protected:
          template< int ... >
@@ -34,7 +34,10 @@ namespace carpc::async {
                using tSptr = std::shared_ptr< Signature >;
 
             private:
-               Signature( ) = default;
+               Signature( )
+               {
+                  m_hash = type_id( ).hash( );
+               }
                Signature( const Signature& other ) = default;
             public:
                ~Signature( ) override = default;
@@ -76,6 +79,7 @@ namespace carpc::async {
          /******************************************************************************
           *
           * Sending CALLABLE async object for execution to appropriate context.
+          * Callable object what can be called only once can't be sent to broadcast context.
           * Parameters:
           *    to_context - context for execution operation object.
           *
@@ -84,18 +88,27 @@ namespace carpc::async {
 
       public:
          virtual void call( ) const = 0;
+         // true - stored arguments are moved into the function by 'call', so it must be called only once.
+         virtual const bool is_single_call( ) const { return false; }
       private:
          void process( IConsumer* p_consumer = nullptr ) const override;
          const eAsyncType type( ) const override final;
 
       private:
-         const IAsync::ISignature::tSptr signature( ) const override;
-         Signature::tSptr mp_signature = Signature::create( );
+         const IAsync::ISignature::tSptr& signature( ) const override;
 
       public:
          const tPriority priority( ) const override;
       private:
          tPriority m_priority = { };
+
+      public:
+         // Must be set before sending. Function of concurrent callable object must not access
+         // state of components what is not protected from parallel access.
+         void concurrent( const bool );
+         const bool is_concurrent( ) const override;
+      private:
+         bool m_concurrent = false;
    };
 
 
@@ -107,9 +120,11 @@ namespace carpc::async {
    }
 
    inline
-   const IAsync::ISignature::tSptr ICallable::signature( ) const
+   const IAsync::ISignature::tSptr& ICallable::signature( ) const
    {
-      return mp_signature;
+      // Signatures of all callable objects are equal, so single signature object is shared by all of them.
+      static const IAsync::ISignature::tSptr s_signature = Signature::create( );
+      return s_signature;
    }
 
    inline
@@ -118,5 +133,17 @@ namespace carpc::async {
       return m_priority;
    }
 
+   inline
+   void ICallable::concurrent( const bool is_concurrent )
+   {
+      m_concurrent = is_concurrent;
+   }
+
+   inline
+   const bool ICallable::is_concurrent( ) const
+   {
+      return m_concurrent;
+   }
+
 } // namespace carpc::async
 
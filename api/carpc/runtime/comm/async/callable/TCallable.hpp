@@ -1,125 +1,99 @@
 #pragma once
 
 #include <tuple>
-#include "carpc/runtime/comm/async/callable/ICallable.hpp"
-// #include "carpc/base/helpers/functions/print.hpp"
+#include <type_traits>
+#include <utility>
 
+#include "carpc/runtime/comm/async/callable/ICallable.hpp"
+#include "carpc/runtime/comm/async/Pool.hpp"
 
 
-// Switching off compiler optimization to avoid warning
-// warning: ‘<anonymous>’ is used uninitialized in this function [-Wuninitialized]
-// which leads not saving paramers because of optimization in case of using function with
-// parameters passed by reference.
-// WARNING: Functions with parameters passed by reference or pointers must be used very carefyle because
-// in current object will be samed corresponding refecences and pointers to these parameters, but these
-// parameters could be chnaged after this and defore calling this function via this object (example 7).
-#pragma GCC push_options
-#pragma GCC optimize ("O0")
 
 namespace carpc::async {
 
-   template < typename ...Args >
-   struct TCallable : public ICallable
+   /*************************
+    *
+    * 'TCallable' - callable async object what stores function object and its arguments inline.
+    * Function object is kept with its own type (function pointer, lambda, functor) instead of
+    * 'std::function', so the only allocation is the pooled block with object and control block
+    * of shared pointer.
+    * Arguments are stored decayed (by value) and are forwarded into the storage, so move-only
+    * types are supported.
+    * Stored arguments are passed to the function as lvalues. In case if function can't accept
+    * lvalues (move-only parameter passed by value) stored arguments are moved into the function,
+    * so such callable object must be called only once ('send' refuses broadcast context for it).
+    * WARNING: use 'std::ref' / 'std::cref' to pass parameters by reference. In this case referenced
+    * objects must be alive till the call.
+    *
+    * **********************/
+   template< typename tFunction, typename ...Args >
+   class TCallable : public ICallable
    {
       public:
-         using tFunctionPtr = void (*)( Args... );
-         using tFunction = std::function< void( Args... ) >;
          using tParameters = std::tuple< Args... >;
 
       private:
-         TCallable( tFunctionPtr p_func, tParameters params )
-            : mp_function( p_func )
-            , m_params( params )
-         {
-         }
-
-         TCallable( tFunctionPtr p_func, Args&... args )
-            : mp_function( p_func )
-            , m_params( args... )
-         {
-         }
-
-         TCallable( tFunction p_func, tParameters params )
-            : m_function( p_func )
-            , m_params( params )
-         {
-         }
-
-         TCallable( tFunction p_func, Args&... args )
-            : m_function( p_func )
-            , m_params( args... )
+         template< typename F, typename ...TYPES >
+         TCallable( F&& function, TYPES&& ... args )
+            : m_function( std::forward< F >( function ) )
+            , m_params( std::forward< TYPES >( args )... )
          {
          }
-
          TCallable( const TCallable& ) = delete;
          TCallable& operator=( const TCallable& ) = delete;
 
       public:
          ~TCallable( ) override = default;
 
-         static tSptr const create( tFunctionPtr p_func, tParameters params )
-         {
-            return std::shared_ptr< TCallable >( new TCallable( p_func, params ) );
-         }
-
-         static tSptr const create( tFunctionPtr p_func, Args&... args )
-         {
-            return std::shared_ptr< TCallable >( new TCallable( p_func, args...  ));
-         }
-
-         static tSptr const create( tFunction func, tParameters params )
-         {
-            return std::shared_ptr< TCallable >( new TCallable( func, params ) );
-         }
-
-         static tSptr const create( tFunction func, Args&... args )
+      // allocation
+      private:
+         template< typename > friend struct pool::__private__::TAllocated;
+      public:
+         template< typename F, typename ...TYPES >
+         static tSptr create( F&& function, TYPES&& ... args )
          {
-            return std::shared_ptr< TCallable >( new TCallable( func, args...  ));
+            return make_async< TCallable >( std::forward< F >( function ), std::forward< TYPES >( args )... );
          }
 
       public:
          void call( ) const override
          {
-            // https://stackoverflow.com/questions/47496358/c-lambdas-how-to-capture-variadic-parameter-pack-from-the-upper-scope
-            std::apply( m_function, m_params );
-
-            // deprecated implementation
-            // call_function( typename gen_sequence< sizeof...( Args ) >::type( ) );
+            if constexpr( std::is_invocable_v< tFunction&, Args&... > )
+               std::apply( m_function, m_params );
+            else
+               std::apply( std::move( m_function ), std::move( m_params ) );
          }
-
-      private:
-         template< int ...S >
-         void call_function( sequence< S... > ) const
+         const bool is_single_call( ) const override
          {
-            // print_pack( std::get< S >( m_params )... );
-            if( nullptr != mp_function )
-               return mp_function( std::get< S >( m_params )... );
-            else if( m_function )
-               return m_function( std::get< S >( m_params )... );
+            return !std::is_invocable_v< tFunction&, Args&... >;
          }
 
       private:
-         const tFunctionPtr      mp_function = nullptr;
-         const tFunction         m_function;
-         const tParameters       m_params;
+         mutable tFunction       m_function;
+         mutable tParameters     m_params;
    };
 
 
 
    namespace callable {
 
-      template < typename ...Args >
-      ICallable::tSptr create( std::function< void( Args... ) > p_func, Args... args )
+      template< typename F, typename ...Args >
+      ICallable::tSptr create( F&& function, Args&& ... args )
       {
-         return TCallable< Args... >::create( p_func, args... );
+         using tCallable = TCallable< std::decay_t< F >, std::decay_t< Args >... >;
+         return tCallable::create( std::forward< F >( function ), std::forward< Args >( args )... );
+      }
+
+      template< typename F, typename ...Args >
+      const bool create_send( const application::Context& to_context, F&& function, Args&& ... args )
+      {
+         return create( std::forward< F >( function ), std::forward< Args >( args )... )->send( to_context );
       }
 
    }
 
 } // namespace carpc::async
 
-#pragma GCC pop_options
-
 
 
 #if 0 // Example
@@ -152,51 +126,46 @@ namespace carpc::async {
 
       // Example 1
       {
-         auto callable = base_v::TCallable< >::create( function_0 );
+         auto callable = carpc_v::callable::create( function_0 );
          callable->call( );
       }
 
       // Example 2
       {
-         std::tuple< int > parameters = std::make_tuple( 111 );
-         auto callable = base_v::TCallable< int >::create( function_1, parameters );
+         auto callable = carpc_v::callable::create( function_1, 111 );
          callable->call( );
       }
 
       // Example 3
       {
-         auto callable = base_v::TCallable< int >::create( function_1, 111 );
+         auto callable = carpc_v::callable::create( function_2, 222 );
          callable->call( );
       }
 
       // Example 4
       {
-         std::tuple< int > parameters = std::make_tuple( 222 );
-         auto callable = base_v::TCallable< const int& >::create( function_2, parameters );
-         callable.call( );
-      }
-
-      // Example 5
-      {
-         auto callable = base_v::TCallable< const int& >::create( function_2, 222 );
-         callable.call( );
-      }
-
-      // Example 6
-      {
-         auto callable = base_v::TCallable< const std::size_t&, const std::string& >::create( function_3, 333, "framework" );
-         callable.call( );
+         auto callable = carpc_v::callable::create( function_3, 333, "framework" );
+         callable->call( );
       }
 
-      // Example 7
+      // Example 5: parameters passed by reference
       {
          std::size_t id = 111;
          std::string name = "framework";
-         auto callable = base_v::TCallable< const std::size_t&, const std::string& >::create( function_3, id, name );
-         callable.call( );
+         auto callable = carpc_v::callable::create( function_3, std::cref( id ), std::cref( name ) );
+         callable->call( );
          id = 222;
          name = "framework_1";
-         callable.call( );
+         callable->call( );
+      }
+
+      // Example 6: move-only parameter
+      {
+         auto callable = carpc_v::callable::create(
+               []( std::unique_ptr< int > p_value ){ MSG_DBG( "value: %d", *p_value ); },
+               std::make_unique< int >( 444 )
+            );
+         callable->call( );
       }
 
 
@@ -0,0 +1,93 @@
+#pragma once
+
+// Coroutine support is available only in case if compiler supports C++20 coroutines.
+#if defined( __cpp_impl_coroutine )
+
+#include <coroutine>
+#include <exception>
+
+#include "carpc/runtime/application/Context.hpp"
+
+
+
+namespace carpc::async::coroutine {
+
+   // Coroutine frames are allocated from thread local block pools of several size classes.
+   // Frames bigger then the largest size class are allocated by system allocator.
+   void* allocate_frame( const std::size_t size );
+   void deallocate_frame( void* p_frame, const std::size_t size );
+
+
+
+   /*************************
+    *
+    * 'Task' - return type of fire-and-forget coroutine executed by application thread.
+    * Coroutine starts immediately in the calling thread and runs till the first suspension.
+    * It is resumed by the thread where awaited operation is completed (for proxy requests this is
+    * the thread owning the proxy, for 'switch_to' - the destination thread).
+    * Frame is destroyed automatically when coroutine is finished.
+    * Example:
+    *    carpc::async::coroutine::Task Client::run( )
+    *    {
+    *       auto response = co_await co_request< tRequestData >( args... );
+    *       if( const tResponseData* p_data = response.template data< tResponseData >( ) ) { ... }
+    *       co_await carpc::async::switch_to( other_context );
+    *    }
+    *
+    * **********************/
+   class Task
+   {
+      public:
+         struct promise_type
+         {
+            Task get_return_object( ) { return { }; }
+            std::suspend_never initial_suspend( ) noexcept { return { }; }
+            std::suspend_never final_suspend( ) noexcept { return { }; }
+            void return_void( ) { }
+            void unhandled_exception( ) { std::terminate( ); }
+
+            static void* operator new( const std::size_t size ) { return allocate_frame( size ); }
+            static void operator delete( void* p_frame, const std::size_t size ) { deallocate_frame( p_frame, size ); }
+         };
+   };
+
+} // namespace carpc::async::coroutine
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'SwitchTo' - awaiter what resumes coroutine in the destination application thread.
+    * Coroutine is resumed via runnable object sent to the destination context.
+    * In case if destination context is the context of current application thread coroutine
+    * is not suspended.
+    * Result of 'co_await' is false in case if runnable object could not be sent. In this case
+    * coroutine continues in the current thread.
+    *
+    * **********************/
+   class SwitchTo
+   {
+      public:
+         SwitchTo( const application::Context& to_context );
+
+      public:
+         bool await_ready( ) const;
+         bool await_suspend( std::coroutine_handle< > handle );
+         bool await_resume( ) const { return m_result; }
+
+      private:
+         application::Context m_to_context;
+         bool                 m_result = true;
+   };
+
+   inline
+   SwitchTo switch_to( const application::Context& to_context )
+   {
+      return SwitchTo( to_context );
+   }
+
+} // namespace carpc::async
+
+#endif // __cpp_impl_coroutine
@@ -6,9 +6,11 @@
 
 
 
-#define DEFINE_EVENT_BASE( scopeType, serviceType, eventType, dataType, signatureType ) \
+// 'isConflated' - pending event of this type is replaced by the new one with the equal signature
+// instead of appending the new one to the queue (latest value wins).
+#define DEFINE_EVENT_BASE_EX( scopeType, serviceType, eventType, dataType, signatureType, isConflated ) \
    scopeType eventType { \
-      class eventType##_TYPE; \
+      struct eventType##_TYPE { static constexpr bool s_conflated = isConflated; }; \
       using Generator      = carpc::async::TGenerator< serviceType, eventType##_TYPE, dataType, signatureType >; \
       using Event          = typename Generator::Config::tEvent; \
       using Signature      = typename Generator::Config::tSignature; \
@@ -17,6 +19,9 @@
       using Consumer       = typename Generator::Config::tConsumer; \
    }
 
+#define DEFINE_EVENT_BASE( scopeType, serviceType, eventType, dataType, signatureType ) \
+   DEFINE_EVENT_BASE_EX( scopeType, serviceType, eventType, dataType, signatureType, false )
+
 
 
 #define DEFINE_EVENT_N( eventType, dataType, signatureType ) \
@@ -100,6 +105,45 @@
 
 
 
+#define DEFINE_CONFLATED_EVENT_N( eventType, dataType, signatureType ) \
+   DEFINE_EVENT_BASE_EX( namespace, carpc::NO_IPC, eventType, dataType, signatureType, true )
+
+#define DEFINE_CONFLATED_EVENT_NOSIG_N( eventType, dataType ) \
+   DEFINE_CONFLATED_EVENT_N( eventType, dataType, carpc::async::simple::Signature )
+
+#define DEFINE_CONFLATED_EVENT_IDSIG_N( eventType, dataType, enumType ) \
+   DEFINE_CONFLATED_EVENT_N( eventType, dataType, carpc::async::id::TSignature< enumType > )
+
+#define DEFINE_CONFLATED_IPC_EVENT_N( eventType, dataType, signatureType ) \
+   DEFINE_EVENT_BASE_EX( namespace, carpc::IPC, eventType, dataType, signatureType, true )
+
+#define DEFINE_CONFLATED_IPC_EVENT_NOSIG_N( eventType, dataType ) \
+   DEFINE_CONFLATED_IPC_EVENT_N( eventType, dataType, carpc::async::simple::Signature )
+
+#define DEFINE_CONFLATED_IPC_EVENT_IDSIG_N( eventType, dataType, enumType ) \
+   DEFINE_CONFLATED_IPC_EVENT_N( eventType, dataType, carpc::async::id::TSignature< enumType > )
+
+#define DEFINE_CONFLATED_EVENT_S( eventType, dataType, signatureType ) \
+   DEFINE_EVENT_BASE_EX( struct, carpc::NO_IPC, eventType, dataType, signatureType, true )
+
+#define DEFINE_CONFLATED_EVENT_NOSIG_S( eventType, dataType ) \
+   DEFINE_CONFLATED_EVENT_S( eventType, dataType, carpc::async::simple::Signature )
+
+#define DEFINE_CONFLATED_EVENT_IDSIG_S( eventType, dataType, enumType ) \
+   DEFINE_CONFLATED_EVENT_S( eventType, dataType, carpc::async::id::TSignature< enumType > )
+
+#define DEFINE_CONFLATED_IPC_EVENT_S( eventType, dataType, signatureType ) \
+   DEFINE_EVENT_BASE_EX( struct, carpc::IPC, eventType, dataType, signatureType, true )
+
+#define DEFINE_CONFLATED_IPC_EVENT_NOSIG_S( eventType, dataType ) \
+   DEFINE_CONFLATED_IPC_EVENT_S( eventType, dataType, carpc::async::simple::Signature )
+
+#define DEFINE_CONFLATED_IPC_EVENT_IDSIG_S( eventType, dataType, enumType ) \
+   DEFINE_CONFLATED_IPC_EVENT_S( eventType, dataType, carpc::async::id::TSignature< enumType > )
+
+
+
+
 #define DEFINE_EVENT                   DEFINE_EVENT_S
 #define DEFINE_EVENT_NOSIG             DEFINE_EVENT_NOSIG_S
 #define DEFINE_EVENT_NODATA            DEFINE_EVENT_NODATA_S
@@ -114,6 +158,14 @@
 #define DEFINE_IPC_EVENT_IDSIG         DEFINE_IPC_EVENT_IDSIG_S
 #define DEFINE_IPC_EVENT_IDSIG_NODATA  DEFINE_IPC_EVENT_IDSIG_NODATA_S
 
+#define DEFINE_CONFLATED_EVENT               DEFINE_CONFLATED_EVENT_S
+#define DEFINE_CONFLATED_EVENT_NOSIG         DEFINE_CONFLATED_EVENT_NOSIG_S
+#define DEFINE_CONFLATED_EVENT_IDSIG         DEFINE_CONFLATED_EVENT_IDSIG_S
+
+#define DEFINE_CONFLATED_IPC_EVENT           DEFINE_CONFLATED_IPC_EVENT_S
+#define DEFINE_CONFLATED_IPC_EVENT_NOSIG     DEFINE_CONFLATED_IPC_EVENT_NOSIG_S
+#define DEFINE_CONFLATED_IPC_EVENT_IDSIG     DEFINE_CONFLATED_IPC_EVENT_IDSIG_S
+
 
 
 // There is alternative method to set event type id manually.
@@ -18,7 +18,7 @@ namespace carpc::async {
       : public IAsync
    {
       public:
-         using tSptr = std::shared_ptr< IEvent >;
+         using tSptr = TAsyncPtr< IEvent >;
          using tCreator = IEvent::tSptr(*)( );
 
       public:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "carpc/base/helpers/macros/types.hpp"
 #include "carpc/runtime/comm/async/event/IEvent.hpp"
 #include "carpc/runtime/comm/async/event/TSignature.hpp"
@@ -17,7 +19,7 @@ namespace carpc::async {
       // using and types
       public:
          using tEvent         = typename _Generator::Config::tEvent;
-         using tEventPtr      = typename std::shared_ptr< tEvent >;
+         using tEventPtr      = TAsyncPtr< tEvent >;
          using tConsumer      = typename _Generator::Config::tConsumer;
          using tService       = typename _Generator::Config::tService;
          using tData          = typename _Generator::Config::tData;
@@ -38,6 +40,16 @@ namespace carpc::async {
       public:
          ~TEvent( ) override = default;
 
+      // allocation
+      // Events are allocated from the pool together with the control block of shared pointer
+      // what is used for aliasing of in-place data.
+      private:
+         template< typename ... TYPES >
+         static tEventPtr allocate( TYPES&& ... args )
+         {
+            return make_async< tEvent >( std::forward< TYPES >( args )... );
+         }
+
       // These static functions are intended to be instantiated for user-defined events
       // WITHOUT a user-specified signature.
       // In this case, subscribing to and unsubscribing from such events occurs WITHOUT
@@ -62,7 +74,7 @@ namespace carpc::async {
          static typename std::enable_if_t< std::is_same_v< U, typename simple::Signature >, tEventPtr >
             create( )
             {
-               return tEventPtr( new tEvent( ) );
+               return allocate( );
             }
 
       // These static functions are intended to be instantiated for user-defined events
@@ -107,14 +119,14 @@ namespace carpc::async {
          static const typename std::enable_if_t< not std::is_same_v< U, typename simple::Signature >, tEventPtr >
             create( const tUserSignature& user_signature )
             {
-               return tEventPtr( new tEvent( user_signature ) );
+               return allocate( user_signature );
             }
 
          template< typename ... TYPES, typename U = tUserSignature >
          static const typename std::enable_if_t< ( not std::is_same_v< U, typename simple::Signature > ) and 0 != sizeof...( TYPES ), tEventPtr >
             create( const TYPES& ... signature_parameters )
             {
-               return tEventPtr( new tEvent( tUserSignature{ signature_parameters... } ) );
+               return allocate( tUserSignature{ signature_parameters... } );
             }
 
       public:
@@ -128,7 +140,7 @@ namespace carpc::async {
          // what should be filled during serialization.
          static IEvent::tSptr create_empty( )
          {
-            return std::shared_ptr< tEvent >( new tEvent( ) );
+            return allocate( );
          }
 
       // virual function
@@ -144,7 +156,7 @@ namespace carpc::async {
          {
             if constexpr( CARPC_IS_IPC_TYPE( tService ) )
             {
-               return ipc::serialize( stream, mp_signature, m_context, m_priority, mp_data );
+               return ipc::serialize( stream, std::static_pointer_cast< tSignature >( mp_signature ), m_context, m_priority, data( ) );
             }
 
             return false;
@@ -153,7 +165,13 @@ namespace carpc::async {
          {
             if constexpr( CARPC_IS_IPC_TYPE( tService ) )
             {
-               return ipc::deserialize( stream, mp_signature, m_context, m_priority, mp_data );
+               // Current signature could be interned and shared with other events, so received
+               // signature is deserialized to the new object and interned after that.
+               typename tSignature::tSptr p_signature = std::make_shared< tSignature >( );
+               m_is_data_in_place = false;
+               const bool result = ipc::deserialize( stream, p_signature, m_context, m_priority, mp_data );
+               mp_signature = tSignature::intern( p_signature->user_signature( ), p_signature );
+               return result;
             }
 
             return false;
@@ -162,38 +180,79 @@ namespace carpc::async {
       public:
          const bool is_ipc( ) const override { return CARPC_IS_IPC_TYPE( tService ); }
 
+      // conflation
+      public:
+         // Event is conflated in case if its type is defined as conflated or in case if
+         // user signature defines this for current event by 'is_conflated' function.
+         const bool is_conflated( ) const override
+         {
+            if constexpr( _Generator::Config::conflated )
+               return true;
+            else if constexpr( __private__::has_is_conflated< tUserSignature >::value )
+               return typed_signature( ).user_signature( ).is_conflated( );
+            else
+               return false;
+         }
+
       // signature
       public:
          template< typename U = tUserSignature >
          const typename std::enable_if_t< not std::is_same_v< U, typename simple::Signature >, tUserSignature >&
             info( ) const
             {
-               return mp_signature->user_signature( );
+               return typed_signature( ).user_signature( );
             }
-         const IAsync::ISignature::tSptr signature( ) const override
+         const IAsync::ISignature::tSptr& signature( ) const override
          {
             return mp_signature;
          }
       private:
-         typename tSignature::tSptr mp_signature = nullptr;
+         const tSignature& typed_signature( ) const
+         {
+            return static_cast< const tSignature& >( *mp_signature );
+         }
+      private:
+         // Stored as pointer to the base to be returned by reference.
+         IAsync::ISignature::tSptr mp_signature = nullptr;
 
       // data
+      // Data passed by value for the first time before dispatching is stored inside of the event
+      // (in the same allocated block). Pointer to such data shares ownership of the block of the event
+      // and could be held by the caller or by consumers of the queued event, so in-place data is never
+      // changed or destroyed till the event is destroyed: any further data is allocated separately.
+      // Builders return handle created from 'this', so chained calls count references of the event
+      // without atomic operations till it is sent to other os thread.
       public:
          const tDataPtr data( ) const
          {
+            if( m_is_data_in_place )
+               return tDataPtr( storage( ), const_cast< tData* >( &( *m_data ) ) );
             return mp_data;
          }
          tEventPtr data( const tData& data )
          {
-            mp_data = std::make_shared< tData >( data );
-            return std::shared_ptr< tEvent >( shared_from_this( ), this );
+            if( false == m_data.has_value( ) && 0 == dispatched_ns( ) )
+            {
+               m_data.emplace( data );
+               m_is_data_in_place = true;
+               mp_data.reset( );
+            }
+            else
+            {
+               m_is_data_in_place = false;
+               mp_data = std::make_shared< tData >( data );
+            }
+            return tEventPtr( this );
          }
          tEventPtr data( const tDataPtr data )
          {
+            m_is_data_in_place = false;
             mp_data = data;
-            return std::shared_ptr< tEvent >( shared_from_this( ), this );
+            return tEventPtr( this );
          }
       private:
+         std::optional< tData > m_data = std::nullopt;
+         bool m_is_data_in_place = false;
          tDataPtr mp_data = nullptr;
 
       // context
@@ -214,10 +273,30 @@ namespace carpc::async {
          tEventPtr priority( const tPriority& value )
          {
             m_priority = value;
-            return std::shared_ptr< tEvent >( shared_from_this( ), this );
+            return tEventPtr( this );
          }
       protected:
          tPriority m_priority = priority::DEFAULT;
+
+      // deadline
+      // Deadline is based on steady clock of current process, so it is not serialized for IPC events.
+      public:
+         const IAsync::tDeadline deadline( ) const override
+         {
+            return m_deadline;
+         }
+         tEventPtr deadline( const IAsync::tDeadline& value )
+         {
+            m_deadline = value;
+            return tEventPtr( this );
+         }
+         template< typename _Rep, typename _Period >
+         tEventPtr deadline( const std::chrono::duration< _Rep, _Period >& timeout )
+         {
+            return deadline( std::chrono::steady_clock::now( ) + timeout );
+         }
+      protected:
+         IAsync::tDeadline m_deadline = IAsync::no_deadline;
    };
 
 } // namespace carpc::async
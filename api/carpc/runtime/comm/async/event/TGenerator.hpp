@@ -1,5 +1,7 @@
 #pragma once
 
+#include <type_traits>
+
 #include "carpc/base/helpers/macros/types.hpp"
 #include "carpc/runtime/comm/async/event/TEvent.hpp"
 #include "carpc/runtime/comm/async/event/TSignature.hpp"
@@ -8,6 +10,21 @@
 
 
 
+namespace carpc::async::__private__ {
+
+   // Checks if event namespace defines conflation for all events of its type by 's_conflated'
+   // (see DEFINE_CONFLATED_EVENT* family of macroses). Events are not conflated by default.
+   template< typename T, typename = void >
+   struct is_conflated_namespace : std::false_type { };
+
+   template< typename T >
+   struct is_conflated_namespace< T, std::void_t< decltype( T::s_conflated ) > >
+      : std::bool_constant< T::s_conflated > { };
+
+} // namespace carpc::async::__private__
+
+
+
 namespace carpc::async {
 
    // Base Event Generator
@@ -26,6 +43,8 @@ namespace carpc::async {
             using tService          = _ServiceType;
             using tProcessor        = void ( tConsumer::* )( const tEvent& );
             using tUserSignature    = _SignatureType;
+            // Defined by DEFINE_CONFLATED_EVENT* family of macroses
+            static constexpr bool conflated = __private__::is_conflated_namespace< _EventNamespace >::value;
          };
    };
 
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
 #include "carpc/runtime/comm/async/event/IEvent.hpp"
 
 #include "carpc/trace/Trace.hpp"
@@ -7,6 +12,54 @@
 
 
 
+namespace carpc::async::__private__ {
+
+   // Checks if user signature provides exact comparison 'operator=='
+   template< typename T, typename = void >
+   struct has_equal : std::false_type { };
+
+   template< typename T >
+   struct has_equal< T, std::void_t< decltype( std::declval< const T& >( ) == std::declval< const T& >( ) ) > >
+      : std::true_type { };
+
+   // Checks if user signature disables interning by 's_intern = false'. It should be done for user
+   // signatures what are unique for almost each event (e.g. contain sequence id), because such
+   // signatures are never reused and only fill the interning table.
+   template< typename T, typename = void >
+   struct is_intern_enabled : std::true_type { };
+
+   template< typename T >
+   struct is_intern_enabled< T, std::void_t< decltype( T::s_intern ) > >
+      : std::bool_constant< T::s_intern > { };
+
+   // Checks if user signature provides 'is_conflated' function what defines conflation for concrete event
+   template< typename T, typename = void >
+   struct has_is_conflated : std::false_type { };
+
+   template< typename T >
+   struct has_is_conflated< T, std::void_t< decltype( std::declval< const T& >( ).is_conflated( ) ) > >
+      : std::true_type { };
+
+   // Checks if user signature provides 'hash' function consistent with its 'operator<'
+   template< typename T, typename = void >
+   struct has_hash : std::false_type { };
+
+   template< typename T >
+   struct has_hash< T, std::void_t< decltype( std::declval< const T& >( ).hash( ) ) > >
+      : std::true_type { };
+
+   // Checks if user signature provides 'flow_id' function what links related events in timeline
+   template< typename T, typename = void >
+   struct has_flow_id : std::false_type { };
+
+   template< typename T >
+   struct has_flow_id< T, std::void_t< decltype( std::declval< const T& >( ).flow_id( ) ) > >
+      : std::true_type { };
+
+} // namespace carpc::async::__private__
+
+
+
 namespace carpc::async {
 
    template< typename _Generator >
@@ -27,15 +80,104 @@ namespace carpc::async {
          }
 
       public:
-         TSignature( ) = default;
+         TSignature( )
+         {
+            m_hash = build_hash( m_user_signature );
+         }
          TSignature( const tUserSignature& user_signature )
             : m_user_signature( user_signature )
-         { }
+         {
+            m_hash = build_hash( m_user_signature );
+         }
          TSignature( const TSignature& other ) = delete;
          ~TSignature( ) override = default;
+         // Returns interned signature (see 'intern'), so new object is allocated only in case if
+         // there is no alive signature with the same user signature created in current thread.
          static tSptr create( const tUserSignature& user_signature = { } )
          {
-            return std::make_shared< tSignature >( user_signature );
+            return intern( user_signature );
+         }
+
+      /***************
+       *
+       * Interning of signatures.
+       * Signatures are immutable after creation, so all equal signatures created in the same
+       * context "thread" are represented by single shared object. This eliminates allocation for
+       * repeated sending and subscription and makes most of comparisons pointer comparisons.
+       * Table is thread local, so it does not require synchronization, and holds only weak
+       * references, so unused signatures are destroyed as usual.
+       * Only user signatures with exact 'operator==' are interned, because equivalence defined by
+       * 'operator<' could treat some fields as wildcards. User signature could disable interning
+       * by 's_intern = false'.
+       *
+       **************/
+      public:
+         // Returns interned signature equal to 'user_signature'. In case if there is no such signature
+         // 'p_signature' (or new signature in case of nullptr) is interned and returned.
+         static tSptr intern( const tUserSignature& user_signature, tSptr p_signature = nullptr )
+         {
+            if constexpr(
+                  not __private__::has_equal< tUserSignature >::value
+                  || not __private__::is_intern_enabled< tUserSignature >::value
+               )
+            {
+               return p_signature ? p_signature : std::make_shared< tSignature >( user_signature );
+            }
+            else
+            {
+               InternTable& table = intern_table( );
+               auto& bucket = table.buckets[ build_hash( user_signature ) ];
+               std::size_t index = 0;
+               while( index < bucket.size( ) )
+               {
+                  tSptr p_interned = bucket[ index ].lock( );
+                  if( nullptr == p_interned )
+                  {
+                     bucket[ index ] = std::move( bucket.back( ) );
+                     bucket.pop_back( );
+                     continue;
+                  }
+                  if( p_interned->m_user_signature == user_signature )
+                     return p_interned;
+                  ++index;
+               }
+
+               if( nullptr == p_signature )
+                  p_signature = std::make_shared< tSignature >( user_signature );
+               bucket.emplace_back( p_signature );
+
+               // Buckets of signatures what are not used any more are not visited by lookup,
+               // so expired records are periodically removed from the whole table.
+               if( 0 == ( ++table.inserted % s_intern_purge_period ) )
+                  table.purge( );
+
+               return p_signature;
+            }
+         }
+      private:
+         struct InternTable
+         {
+            void purge( )
+            {
+               for( auto iterator = buckets.begin( ); iterator != buckets.end( ); )
+               {
+                  auto& bucket = iterator->second;
+                  bucket.erase(
+                        std::remove_if( bucket.begin( ), bucket.end( ), []( const auto& p ){ return p.expired( ); } ),
+                        bucket.end( )
+                     );
+                  iterator = bucket.empty( ) ? buckets.erase( iterator ) : std::next( iterator );
+               }
+            }
+
+            std::unordered_map< std::size_t, std::vector< std::weak_ptr< tSignature > > > buckets;
+            std::size_t inserted = 0;
+         };
+         static constexpr std::size_t s_intern_purge_period = 1024;
+         static InternTable& intern_table( )
+         {
+            thread_local InternTable s_table;
+            return s_table;
          }
 
       public:
@@ -56,6 +198,20 @@ namespace carpc::async {
 
             return m_user_signature < static_cast< const tSignature& >( other ).m_user_signature;
          }
+         bool operator==( const IAsync::ISignature& other ) const override
+         {
+            // Interned signatures are equal only in case if they are the same object.
+            if( this == &other )
+               return true;
+            if( other.type_id( ) != type_id( ) )
+               return false;
+
+            const tUserSignature& other_user_signature = static_cast< const tSignature& >( other ).m_user_signature;
+            if constexpr( __private__::has_equal< tUserSignature >::value )
+               return m_user_signature == other_user_signature;
+            else
+               return !( m_user_signature < other_user_signature ) && !( other_user_signature < m_user_signature );
+         }
          const bool to_stream( ipc::tStream& stream ) const override
          {
             if constexpr( CARPC_IS_IPC_TYPE( tService ) )
@@ -68,19 +224,43 @@ namespace carpc::async {
          {
             if constexpr( CARPC_IS_IPC_TYPE( tService ) )
             {
-               return ipc::deserialize( stream, m_user_signature );
+               // Must be called only for signature what is not interned yet.
+               const bool result = ipc::deserialize( stream, m_user_signature );
+               m_hash = build_hash( m_user_signature );
+               return result;
             }
             return false;
          }
+         std::uint64_t flow_id( ) const override
+         {
+            if constexpr( __private__::has_flow_id< tUserSignature >::value )
+               return m_user_signature.flow_id( );
+            else
+               return 0;
+         }
 
       public:
          const tUserSignature& user_signature( ) const
          {
             return m_user_signature;
          }
-         void user_signature( const tUserSignature& signature )
+         // Removed: interned signature is shared by all events with equal user signature and is used
+         // as a key of intern tables and consumer maps, so it must never be changed.
+         // Kept only to give meaningful compilation error for existing callers.
+         template< typename U = tUserSignature >
+         void user_signature( const U& )
+         {
+            static_assert( sizeof( U ) == 0, "signatures are interned and immutable: use 'create' with new user signature" );
+         }
+      private:
+         // User signature without 'hash' function is hashed only by type id, so all signatures
+         // of such event are placed to the same bucket and are distinguished by 'operator<'.
+         static std::size_t build_hash( const tUserSignature& user_signature )
          {
-            m_user_signature = signature;
+            std::size_t hash = build_type_id( ).hash( );
+            if constexpr( __private__::has_hash< tUserSignature >::value )
+               hash = hash_combine( hash, user_signature.hash( ) );
+            return hash;
          }
       private:
          // static const tAsyncTypeID ms_type_id;
@@ -117,6 +297,14 @@ namespace carpc::async::simple {
          {
             return false;
          }
+         bool operator==( const Signature& other ) const
+         {
+            return true;
+         }
+         std::size_t hash( ) const
+         {
+            return 0;
+         }
          const bool to_stream( ipc::tStream& stream ) const
          {
             return true;
@@ -155,6 +343,19 @@ namespace carpc::async::id {
          {
             return m_id < other.m_id;
          }
+         bool operator==( const TSignature& other ) const
+         {
+            return !( m_id < other.m_id ) && !( other.m_id < m_id );
+         }
+         std::size_t hash( ) const
+         {
+            // Only enumerations and integral identifiers could be hashed, all other identifiers
+            // are distinguished by 'operator<'.
+            if constexpr( std::is_enum_v< _ID > || std::is_integral_v< _ID > )
+               return std::hash< std::size_t >{ }( static_cast< std::size_t >( m_id ) );
+            else
+               return 0;
+         }
          const bool to_stream( ipc::tStream& stream ) const
          {
             return ipc::serialize( stream, m_id );
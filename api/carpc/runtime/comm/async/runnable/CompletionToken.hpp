@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'CompletionToken' - one-shot completion flag what is intended to be allocated on the stack
+    * of waiting thread. Waiting thread spins for a short time and then sleeps on futex,
+    * so neither waiting nor notification allocates memory or locks mutex.
+    * Notification does not access the token after its state has been changed, so waiting thread
+    * can destroy the token right after 'wait' returns.
+    *
+    * **********************/
+   class CompletionToken
+   {
+      public:
+         CompletionToken( ) = default;
+         CompletionToken( const CompletionToken& ) = delete;
+         CompletionToken& operator=( const CompletionToken& ) = delete;
+
+      public:
+         void wait( );
+         void notify( );
+         bool is_completed( ) const;
+
+      private:
+         enum eState : std::uint32_t { PENDING = 0, WAITING = 1, COMPLETED = 2 };
+         std::atomic< std::uint32_t >  m_state = PENDING;
+   };
+
+
+
+   inline
+   bool CompletionToken::is_completed( ) const
+   {
+      return COMPLETED == m_state.load( std::memory_order_acquire );
+   }
+
+} // namespace carpc::async
@@ -14,7 +14,7 @@ namespace carpc::async {
       : public IAsync
    {
       public:
-         using tSptr = std::shared_ptr< IRunnable >;
+         using tSptr = TAsyncPtr< IRunnable >;
          using tOperation = std::function< void( void ) >;
          using tOperationPtr = void(*)( void );
 
@@ -25,7 +25,10 @@ namespace carpc::async {
                using tSptr = std::shared_ptr< Signature >;
 
             private:
-               Signature( ) = default;
+               Signature( )
+               {
+                  m_hash = type_id( ).hash( );
+               }
                Signature( const Signature& other ) = default;
             public:
                ~Signature( ) override = default;
@@ -61,7 +64,7 @@ namespace carpc::async {
          };
 
       public:
-         IRunnable( const tOperation, const tPriority& priority = { } );
+         IRunnable( const tOperation, const tPriority& priority = { }, const tDeadline& deadline = no_deadline );
          ~IRunnable( ) override = default;
 
       public:
@@ -79,19 +82,32 @@ namespace carpc::async {
           *****************************************************************************/
          const bool send( const application::Context& to_context = application::Context::internal_local, const bool is_block = false );
 
-      private:
+      protected:
          void process( IAsync::IConsumer* ) const override;
+      private:
          const eAsyncType type( ) const override final;
 
       private:
-         const IAsync::ISignature::tSptr signature( ) const override;
-         Signature::tSptr mp_signature = Signature::create( );
+         const IAsync::ISignature::tSptr& signature( ) const override;
 
       public:
          const tPriority priority( ) const override;
       private:
          tPriority m_priority = { };
 
+      public:
+         const tDeadline deadline( ) const override;
+      private:
+         tDeadline m_deadline = no_deadline;
+
+      public:
+         // Must be set before sending. Operation of concurrent runnable object must not access
+         // state of components what is not protected from parallel access.
+         void concurrent( const bool );
+         const bool is_concurrent( ) const override;
+      private:
+         bool m_concurrent = false;
+
       private:
          tOperation m_operation = nullptr;
    };
@@ -99,8 +115,9 @@ namespace carpc::async {
 
 
    inline
-   IRunnable::IRunnable( const tOperation operation, const tPriority& priority )
+   IRunnable::IRunnable( const tOperation operation, const tPriority& priority, const tDeadline& deadline )
       : m_priority( priority )
+      , m_deadline( deadline )
       , m_operation( operation )
    {
    }
@@ -112,9 +129,11 @@ namespace carpc::async {
    }
 
    inline
-   const IAsync::ISignature::tSptr IRunnable::signature( ) const
+   const IAsync::ISignature::tSptr& IRunnable::signature( ) const
    {
-      return mp_signature;
+      // Signatures of all runnable objects are equal, so single signature object is shared by all of them.
+      static const IAsync::ISignature::tSptr s_signature = Signature::create( );
+      return s_signature;
    }
 
    inline
@@ -123,4 +142,22 @@ namespace carpc::async {
       return m_priority;
    }
 
+   inline
+   const IAsync::tDeadline IRunnable::deadline( ) const
+   {
+      return m_deadline;
+   }
+
+   inline
+   void IRunnable::concurrent( const bool is_concurrent )
+   {
+      m_concurrent = is_concurrent;
+   }
+
+   inline
+   const bool IRunnable::is_concurrent( ) const
+   {
+      return m_concurrent;
+   }
+
 } // namespace carpc::async
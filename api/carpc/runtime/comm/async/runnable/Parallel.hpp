@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "carpc/runtime/comm/async/runnable/IRunnable.hpp"
+
+
+
+namespace carpc::async {
+
+   using tContexts = std::vector< application::Context >;
+   // Continuation gets 'false' in case if some operations were not delivered for execution.
+   using tContinuation = std::function< void( const bool ) >;
+
+   /******************************************************************************
+    *
+    * Fork-join execution of operations in several application threads.
+    * Each operation is sent as concurrent runnable object to one of 'contexts' by turns,
+    * so in case if destination thread has workers operations are distributed between them
+    * (see 'Thread::Configuration::m_workers').
+    * Calling thread is not blocked. When all operations are finished continuation is sent
+    * as runnable object to the context of calling application thread. In case if calling
+    * thread is not application thread continuation is called by the thread what has
+    * finished the last operation.
+    * Parameters:
+    *    operations - operations to be executed. Must be safe to be executed in parallel.
+    *    continuation - function to be called after all operations are finished.
+    *    contexts - contexts for execution of operations (context of calling thread in case if empty).
+    *       Broadcast and external contexts are not allowed: nothing is sent in this case and
+    *       continuation gets 'false'.
+    * Returns false in case if some operations were not delivered.
+    *
+    *****************************************************************************/
+   const bool when_all(
+         std::vector< IRunnable::tOperation > operations,
+         tContinuation continuation,
+         const tContexts& contexts = { }
+      );
+
+   /******************************************************************************
+    *
+    * Calls 'function( index )' for each index in range [ begin, end ) in several application threads.
+    * Range is split into chunks of 'grain' indexes (by default number of chunks is about
+    * four times more then number of contexts to have a possibility to balance the load)
+    * and chunks are executed via 'when_all'.
+    * 'function' is shared by all chunks, so it must be safe to be called in parallel.
+    *
+    *****************************************************************************/
+   template< typename F >
+   const bool parallel_for(
+         const std::size_t begin, const std::size_t end,
+         F&& function,
+         tContinuation continuation,
+         const tContexts& contexts = { },
+         std::size_t grain = 0
+      )
+   {
+      const std::size_t size = end > begin ? end - begin : 0;
+      if( 0 == grain )
+      {
+         const std::size_t chunks = 4 * std::max( contexts.size( ), std::size_t{ 1 } );
+         grain = std::max( ( size + chunks - 1 ) / chunks, std::size_t{ 1 } );
+      }
+
+      auto p_function = std::make_shared< std::decay_t< F > >( std::forward< F >( function ) );
+      std::vector< IRunnable::tOperation > operations;
+      operations.reserve( ( size + grain - 1 ) / grain );
+      for( std::size_t chunk_begin = begin; chunk_begin < end; chunk_begin += std::min( grain, end - chunk_begin ) )
+      {
+         const std::size_t chunk_end = chunk_begin + std::min( grain, end - chunk_begin );
+         operations.emplace_back(
+               [ p_function, chunk_begin, chunk_end ]( )
+               {
+                  for( std::size_t index = chunk_begin; index < chunk_end; ++index )
+                     ( *p_function )( index );
+               }
+            );
+      }
+
+      return when_all( std::move( operations ), std::move( continuation ), contexts );
+   }
+
+} // namespace carpc::async
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <optional>
+#include <type_traits>
+
+#include "carpc/runtime/comm/async/Pool.hpp"
 #include "carpc/runtime/comm/async/runnable/IRunnable.hpp"
+#include "carpc/runtime/comm/async/runnable/CompletionToken.hpp"
 
 
 
@@ -9,24 +14,100 @@ namespace carpc::async {
    class Runnable : public IRunnable
    {
       private:
-         Runnable( const tOperation );
+         Runnable( const tOperation, const tDeadline& deadline = no_deadline );
 
       public:
          ~Runnable( ) override = default;
-         static tSptr create( const tOperation );
+         static tSptr create( const tOperation, const tDeadline& deadline = no_deadline );
          static const bool create_send(
                const tOperation,
                const application::Context& to_context = application::Context::internal_local,
                const bool is_block = false
             );
+
+      // allocation
+      private:
+         template< typename > friend struct pool::__private__::TAllocated;
+
+      public:
+         /******************************************************************************
+          *
+          * Synchronous call of function in the appropriate context.
+          * Calling thread is blocked until function is executed and its result is returned.
+          * In case if 'to_context' is the context of calling application thread, function
+          * is executed immediately without sending runnable object.
+          * Completion is signaled via token allocated on the stack of calling thread, so
+          * the only allocation is the runnable object itself.
+          * Parameters:
+          *    to_context - context for execution of the function.
+          *    function - function to be executed. Must be alive till the end of the call.
+          * In case if runnable object can't be delivered to the context error message is printed
+          * and default constructed value is returned.
+          *
+          *****************************************************************************/
+         template< typename F >
+         static std::decay_t< std::invoke_result_t< F& > > call( const application::Context& to_context, F&& function );
+      private:
+         // Returns true in case if function must be executed immediately in calling thread.
+         // Returns false in case if function must be sent.
+         // 'is_valid' is set to false in case if function can't be called for the context.
+         static bool is_current( const application::Context&, bool& is_valid );
    };
 
 
 
    inline
-   Runnable::Runnable( const tOperation operation )
-      : IRunnable( operation )
+   Runnable::Runnable( const tOperation operation, const tDeadline& deadline )
+      : IRunnable( operation, { }, deadline )
+   {
+   }
+
+   template< typename F >
+   std::decay_t< std::invoke_result_t< F& > > Runnable::call( const application::Context& to_context, F&& function )
    {
+      using tResult = std::decay_t< std::invoke_result_t< F& > >;
+      constexpr bool is_void = std::is_void_v< tResult >;
+
+      bool is_valid = true;
+      if( is_current( to_context, is_valid ) )
+         return function( );
+      if( false == is_valid )
+      {
+         if constexpr( is_void )
+            return;
+         else
+            return tResult{ };
+      }
+
+      // Whole state of the call is located on the stack of calling thread.
+      // Runnable operation captures only pointer to it, so it fits small buffer of 'std::function'.
+      struct Call
+      {
+         F&                         function;
+         CompletionToken            token;
+         std::optional< std::conditional_t< is_void, bool, tResult > > result;
+      } call{ function, { }, std::nullopt };
+
+      auto operation = [ p_call = &call ]( )
+      {
+         if constexpr( is_void )
+            p_call->function( );
+         else
+            p_call->result.emplace( p_call->function( ) );
+         p_call->token.notify( );
+      };
+
+      if( false == create( operation )->send( to_context ) )
+      {
+         if constexpr( is_void )
+            return;
+         else
+            return tResult{ };
+      }
+
+      call.token.wait( );
+      if constexpr( false == is_void )
+         return std::move( *call.result );
    }
 
 } // namespace carpc::async
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+
+#include "carpc/runtime/comm/async/Pool.hpp"
+#include "carpc/runtime/comm/async/runnable/IRunnable.hpp"
+
+
+
+namespace carpc::async {
+
+   /*************************
+    *
+    * 'RunnableBatch' - runnable async object what contains several operations.
+    * Operations are executed one by one in order of adding in the context where batch was sent,
+    * so sending N operations to other application thread costs single allocation of async object,
+    * single insertion into the queue and single wake up of the thread.
+    * Operations must be added before sending the batch. Batch can't be modified after sending.
+    *
+    * **********************/
+   class RunnableBatch : public IRunnable
+   {
+      public:
+         using tSptr = TAsyncPtr< RunnableBatch >;
+         using tOperations = std::vector< tOperation >;
+
+      private:
+         RunnableBatch( const std::size_t reserve, const tDeadline& deadline );
+
+      public:
+         ~RunnableBatch( ) override = default;
+         static tSptr create( const std::size_t reserve = 0, const tDeadline& deadline = no_deadline );
+         static const bool create_send(
+               tOperations operations,
+               const application::Context& to_context = application::Context::internal_local,
+               const bool is_block = false
+            );
+
+      // allocation
+      private:
+         template< typename > friend struct pool::__private__::TAllocated;
+
+      public:
+         void add( const tOperation& );
+         void add( tOperation&& );
+         std::size_t size( ) const;
+         bool empty( ) const;
+      private:
+         void process( IAsync::IConsumer* ) const override;
+      private:
+         tOperations          m_operations;
+   };
+
+
+
+   inline
+   void RunnableBatch::add( const tOperation& operation )
+   {
+      m_operations.push_back( operation );
+   }
+
+   inline
+   void RunnableBatch::add( tOperation&& operation )
+   {
+      m_operations.push_back( std::move( operation ) );
+   }
+
+   inline
+   std::size_t RunnableBatch::size( ) const
+   {
+      return m_operations.size( );
+   }
+
+   inline
+   bool RunnableBatch::empty( ) const
+   {
+      return m_operations.empty( );
+   }
+
+} // namespace carpc::async
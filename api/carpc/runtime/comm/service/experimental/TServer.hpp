@@ -5,6 +5,7 @@
 #include "carpc/runtime/comm/service/experimental/TGenerator.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "TServer"
 
 
@@ -609,14 +610,14 @@ namespace carpc::service::experimental::__private__ {
    template< typename _TGenerator >
    void TServer< _TGenerator >::process_event( const typename _TGenerator::method::tEvent& event )
    {
-      SYS_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
+      RT_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
       m_method_processor.process( event );
    }
 
    template< typename _TGenerator >
    void TServer< _TGenerator >::process_event( const typename _TGenerator::attribute::tEvent& event )
    {
-      SYS_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
+      RT_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
       m_attribute_processor.process( event );
    }
 
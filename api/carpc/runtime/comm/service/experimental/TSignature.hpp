@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include "carpc/runtime/comm/service/Types.hpp"
 
 
@@ -25,6 +27,8 @@ namespace carpc::service::experimental {
       public:
          const std::string dbg_name( ) const;
          bool operator<( const TSignature& ) const;
+         std::size_t hash( ) const;
+         bool operator==( const TSignature& ) const;
          const bool to_stream( ipc::tStream& ) const;
          const bool from_stream( ipc::tStream& );
 
@@ -102,6 +106,27 @@ namespace carpc::service::experimental {
       return m_type < other.m_type;
    }
 
+   template< typename _ID >
+   bool TSignature< _ID >::operator==( const TSignature& other ) const
+   {
+      return m_from == other.m_from
+         && m_to == other.m_to
+         && m_role == other.m_role
+         && m_id == other.m_id
+         && m_type == other.m_type
+         && m_seq_id == other.m_seq_id;
+   }
+
+   template< typename _ID >
+   std::size_t TSignature< _ID >::hash( ) const
+   {
+      // Only role, id and type are hashed because 'from' and 'to' could be wildcards for 'operator<'.
+      std::size_t hash = std::hash< std::string_view >{ }( m_role.value( ) );
+      hash = async::hash_combine( hash, std::hash< std::string_view >{ }( m_id.c_str( ) ) );
+      hash = async::hash_combine( hash, std::hash< std::string_view >{ }( m_type.c_str( ) ) );
+      return hash;
+   }
+
    template< typename _ID >
    const bool TSignature< _ID >::to_stream( ipc::tStream& stream ) const
    {
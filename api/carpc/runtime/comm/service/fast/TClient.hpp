@@ -3,6 +3,7 @@
 #include "carpc/runtime/comm/service/IClient.hpp"
 #include "carpc/runtime/comm/service/fast/TProxy.hpp"
 #include "carpc/runtime/comm/service/fast/TGenerator.hpp"
+#include "carpc/runtime/comm/service/fast/TRequestAwaiter.hpp"
 
 #include "carpc/trace/Trace.hpp"
 #define CLASS_ABBR "TClientFast"
@@ -34,6 +35,13 @@ namespace carpc::service::fast::__private__ {
             const bool unsubscribe( tClient* p_client );
          template< typename tResponseData >
             const tResponseData* get_event_data( const typename TYPES::tEvent& );
+#if defined( __cpp_impl_coroutine )
+         // Sends the request and suspends calling coroutine till response or busy event is received.
+         // Response is delivered directly to the coroutine, not to 'process_response_event'.
+         // Coroutine frame is destroyed without resuming in case if client is destroyed before response.
+         template< typename tRequestData, typename... Args >
+            TRequestAwaiter< TYPES, tRequestData, Args... > co_request( const Args&... );
+#endif
 
       private:
          tProxy* proxy( ) const;
@@ -67,6 +75,8 @@ namespace carpc::service::fast::__private__ {
       if( mp_proxy )
       {
          SYS_VRB( "destroyed: %s", mp_proxy->signature( ).dbg_name( ).c_str( ) );
+         // Pending responses must not be delivered to destroyed client or to its coroutines.
+         mp_proxy->drop_requests( this );
          mp_proxy->unregister_client( this );
          mp_proxy = nullptr;
       }
@@ -104,6 +114,15 @@ namespace carpc::service::fast::__private__ {
       return nullptr;
    }
 
+#if defined( __cpp_impl_coroutine )
+   template< typename TYPES >
+   template< typename tRequestData, typename... Args >
+   TRequestAwaiter< TYPES, tRequestData, Args... > TClient< TYPES >::co_request( const Args&... args )
+   {
+      return TRequestAwaiter< TYPES, tRequestData, Args... >( mp_proxy, this, args... );
+   }
+#endif
+
    template< typename TYPES >
    typename TClient< TYPES >::tProxy* TClient< TYPES >::proxy( ) const
    {
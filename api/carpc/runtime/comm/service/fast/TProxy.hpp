@@ -1,10 +1,15 @@
 #pragma once
 
+#include <functional>
+#include <map>
+#include <vector>
+
 #include "carpc/runtime/application/Process.hpp"
 #include "carpc/runtime/comm/service/IProxy.hpp"
 #include "carpc/runtime/comm/service/fast/TClient.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "TProxyFast"
 
 
@@ -28,9 +33,23 @@ namespace carpc::service::fast::__private__ {
    struct RequestDB
    {
       using tClient = TClient< TYPES >;
+      // Response handler gets nullptr in case if request was cancelled because of disconnection.
+      using tResponseHandler = std::function< void( const typename TYPES::tEvent* ) >;
+      // Drop handler is called instead of response handler in case if owner of the request (client
+      // or proxy) is destroyed, so response handler must not be called any more.
+      using tDropHandler = std::function< void( ) >;
+      // Response is delivered either to client or to handler.
+      // Waiter without client and handler belongs to dropped request: its response is ignored.
+      struct Waiter
+      {
+         tClient*                               p_client = nullptr;
+         tResponseHandler                       handler = nullptr;
+         const tClient*                         p_owner = nullptr;
+         tDropHandler                           drop_handler = nullptr;
+      };
 
       std::size_t                               m_count = 0;
-      std::map< comm::sequence::ID, tClient* >  m_client_map;
+      std::map< comm::sequence::ID, Waiter >    m_client_map;
    };
 
 
@@ -41,15 +60,30 @@ namespace carpc::service::fast::__private__ {
       using tProxy = TProxy< TYPES >;
       using tClient = TClient< TYPES >;
       using tRequestDB = RequestDB< TYPES >;
+      using tWaiter = typename tRequestDB::Waiter;
+
+      public:
+         using tResponseHandler = typename tRequestDB::tResponseHandler;
+         using tDropHandler = typename tRequestDB::tDropHandler;
 
       public:
          RequestProcessor( tProxy* );
          void reset( );
+         // Drops pending requests of the client (all pending requests in case of nullptr):
+         // their responses will not be delivered.
+         void drop( const tClient* p_owner );
 
       public:
          template< typename tRequestData, typename... Args >
             const comm::sequence::ID request( tClient* p_client, const Args&... args );
+         template< typename tRequestData, typename... Args >
+            const comm::sequence::ID request_handler( const tClient* p_owner, tResponseHandler handler, tDropHandler drop_handler, const Args&... args );
          const bool response( const typename TYPES::tEvent& );
+      private:
+         template< typename tRequestData, typename... Args >
+            const comm::sequence::ID request_waiter( tWaiter&& waiter, const Args&... args );
+         // Cancels requests waiting by handlers.
+         void cancel_handlers( );
 
       private:
          comm::sequence::ID                                 m_seq_id = comm::sequence::ID::zero;
@@ -72,13 +106,77 @@ namespace carpc::service::fast::__private__ {
    template< typename TYPES >
    void RequestProcessor< TYPES >::reset( )
    {
+      cancel_handlers( );
       for( auto item : m_map )
          item.second = tRequestDB{ };
    }
 
+   template< typename TYPES >
+   void RequestProcessor< TYPES >::cancel_handlers( )
+   {
+      // Handlers are collected before calling, because they could send new requests.
+      std::vector< tResponseHandler > handlers;
+      for( auto& item : m_map )
+      {
+         auto& client_map = item.second.m_client_map;
+         for( auto iterator = client_map.begin( ); iterator != client_map.end( ); )
+         {
+            if( nullptr == iterator->second.handler )
+            {
+               ++iterator;
+               continue;
+            }
+
+            handlers.emplace_back( std::move( iterator->second.handler ) );
+            iterator = client_map.erase( iterator );
+         }
+      }
+
+      for( auto& handler : handlers )
+         handler( nullptr );
+   }
+
+   template< typename TYPES >
+   void RequestProcessor< TYPES >::drop( const tClient* p_owner )
+   {
+      // Drop handlers are collected before calling, because they could destroy objects what send new requests.
+      std::vector< tDropHandler > drop_handlers;
+      for( auto& item : m_map )
+      {
+         for( auto& client_item : item.second.m_client_map )
+         {
+            tWaiter& waiter = client_item.second;
+            if( nullptr != p_owner && p_owner != waiter.p_client && p_owner != waiter.p_owner )
+               continue;
+
+            // Waiter stays in the map, so the response of dropped request is consumed silently.
+            if( nullptr != waiter.handler && nullptr != waiter.drop_handler )
+               drop_handlers.emplace_back( std::move( waiter.drop_handler ) );
+            waiter = tWaiter{ };
+         }
+      }
+
+      for( auto& drop_handler : drop_handlers )
+         drop_handler( );
+   }
+
    template< typename TYPES >
    template< typename tRequestData, typename... Args >
    const comm::sequence::ID RequestProcessor< TYPES >::request( tClient* p_client, const Args&... args )
+   {
+      return request_waiter< tRequestData >( tWaiter{ p_client, nullptr }, args... );
+   }
+
+   template< typename TYPES >
+   template< typename tRequestData, typename... Args >
+   const comm::sequence::ID RequestProcessor< TYPES >::request_handler( const tClient* p_owner, tResponseHandler handler, tDropHandler drop_handler, const Args&... args )
+   {
+      return request_waiter< tRequestData >( tWaiter{ nullptr, std::move( handler ), p_owner, std::move( drop_handler ) }, args... );
+   }
+
+   template< typename TYPES >
+   template< typename tRequestData, typename... Args >
+   const comm::sequence::ID RequestProcessor< TYPES >::request_waiter( tWaiter&& waiter, const Args&... args )
    {
       auto event_id_iterator = m_map.find( tRequestData::REQUEST );
       if( m_map.end( ) == event_id_iterator )
@@ -119,10 +217,10 @@ namespace carpc::service::fast::__private__ {
          // Also new sequence id and corresponding client pointer are added to the map for later client identifying in response by sequence id
          // received from server.
          auto& client_map = event_id_iterator->second.m_client_map;
-         auto result = client_map.emplace( ++m_seq_id, p_client );
+         auto result = client_map.emplace( ++m_seq_id, std::move( waiter ) );
          if( false == result.second )
          {
-            SYS_WRN( "can not insert: %s -> %p", m_seq_id.dbg_name( ).c_str( ), p_client );
+            SYS_WRN( "can not insert: %s", m_seq_id.dbg_name( ).c_str( ) );
             return comm::sequence::ID::invalid;
          }
       }
@@ -194,8 +292,13 @@ namespace carpc::service::fast::__private__ {
             SYS_WRN( "delivered event to unknown client" );
             return false;
          }
-         seq_id_iterator->second->process_response_event( event );
+         // Waiter is removed before delivering the response, because handler could send new requests.
+         tWaiter waiter = std::move( seq_id_iterator->second );
          client_map.erase( seq_id_iterator );
+         if( nullptr != waiter.p_client )
+            waiter.p_client->process_response_event( event );
+         else if( nullptr != waiter.handler )
+            waiter.handler( &event );
 
          return true;
       }
@@ -409,8 +512,16 @@ namespace carpc::service::fast::__private__ {
          void process_event( const typename TYPES::tEvent& ) override final;
 
       public:
+         using tResponseHandler = typename tRequestProcessor::tResponseHandler;
+         using tDropHandler = typename tRequestProcessor::tDropHandler;
          template< typename tRequestData, typename... Args >
             const comm::sequence::ID request( tClient*, const Args&... args );
+         // Response is delivered to the handler. In case if owner client is destroyed before the response
+         // is received drop handler is called instead (see 'drop_requests').
+         template< typename tRequestData, typename... Args >
+            const comm::sequence::ID request_handler( const tClient*, tResponseHandler, tDropHandler, const Args&... args );
+         // Must be called by client before its destruction.
+         void drop_requests( const tClient* );
          template< typename tNotificationData >
             const bool subscribe( tClient* );
          template< typename tNotificationData >
@@ -437,6 +548,7 @@ namespace carpc::service::fast::__private__ {
    template< typename TYPES >
    TProxy< TYPES >::~TProxy( )
    {
+      m_request_processor.drop( nullptr );
       TYPES::tEvent::clear_all_notifications( this );
    }
 
@@ -492,7 +604,7 @@ namespace carpc::service::fast::__private__ {
       const comm::sequence::ID seq_id = event.info( ).seq_id( );
       const auto from_context = event.context( );
 
-      SYS_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
+      RT_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
 
       if( true == m_request_processor.response( event ) )
          return;
@@ -515,6 +627,25 @@ namespace carpc::service::fast::__private__ {
       return m_request_processor.template request< tRequestData >( p_client, args... );
    }
 
+   template< typename TYPES >
+   template< typename tRequestData, typename... Args >
+   const comm::sequence::ID TProxy< TYPES >::request_handler( const tClient* p_owner, tResponseHandler handler, tDropHandler drop_handler, const Args&... args )
+   {
+      if( !is_connected( ) )
+      {
+         SYS_WRN( "proxy is not connected" );
+         return comm::sequence::ID::invalid;
+      }
+
+      return m_request_processor.template request_handler< tRequestData >( p_owner, std::move( handler ), std::move( drop_handler ), args... );
+   }
+
+   template< typename TYPES >
+   void TProxy< TYPES >::drop_requests( const tClient* p_client )
+   {
+      m_request_processor.drop( p_client );
+   }
+
    template< typename TYPES >
    template< typename tNotificationData >
    const bool TProxy< TYPES >::subscribe( tClient* p_client )
@@ -0,0 +1,134 @@
+#pragma once
+
+// Coroutine support is available only in case if compiler supports C++20 coroutines.
+#if defined( __cpp_impl_coroutine )
+
+#include <coroutine>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#include "carpc/runtime/comm/async/coroutine/Coroutine.hpp"
+
+
+
+namespace carpc::service::fast::__private__ {
+
+   template< typename TYPES >
+      class TProxy;
+
+   template< typename TYPES >
+      class TClient;
+
+
+
+   /*************************
+    *
+    * 'TResponse' - result of awaiting the request.
+    * Keeps received response or busy event alive, so its data could be accessed after
+    * further suspensions of the coroutine.
+    *
+    * **********************/
+   template< typename TYPES, typename tRequestData >
+   class TResponse
+   {
+      public:
+         using tProxy = TProxy< TYPES >;
+         using tEventPtr = carpc::async::TAsyncPtr< const typename TYPES::tEvent >;
+
+      public:
+         TResponse( tProxy* p_proxy, tEventPtr p_event )
+            : mp_proxy( p_proxy )
+            , mp_event( std::move( p_event ) )
+         { }
+
+      public:
+         // false - request was not sent, has no response or was cancelled because of disconnection.
+         bool is_valid( ) const { return nullptr != mp_event; }
+         bool is_busy( ) const { return is_valid( ) && tRequestData::BUSY == mp_event->info( ).id( ); }
+         const typename TYPES::tEvent* event( ) const { return mp_event.get( ); }
+         template< typename tResponseData >
+            const tResponseData* data( ) const
+            {
+               if( false == is_valid( ) || true == is_busy( ) )
+                  return nullptr;
+               return mp_proxy->template get_event_data< tResponseData >( *mp_event );
+            }
+
+      private:
+         tProxy*     mp_proxy = nullptr;
+         tEventPtr   mp_event = nullptr;
+   };
+
+
+
+   /*************************
+    *
+    * 'TRequestAwaiter' - awaiter what sends the request and resumes coroutine when
+    * response or busy event is received by the proxy (in the thread owning the proxy).
+    * Arguments of the request are copied, so awaiter could be created before 'co_await'.
+    * In case if the request could not be sent or has no response coroutine is not suspended.
+    * In case if the client or the proxy is destroyed while coroutine is suspended, the coroutine
+    * frame is destroyed without resuming.
+    *
+    * **********************/
+   template< typename TYPES, typename tRequestData, typename... Args >
+   class TRequestAwaiter
+   {
+      public:
+         using tProxy = TProxy< TYPES >;
+         using tClient = TClient< TYPES >;
+         using tResponse = TResponse< TYPES, tRequestData >;
+
+      public:
+         TRequestAwaiter( tProxy* p_proxy, const tClient* p_client, const Args&... args )
+            : mp_proxy( p_proxy )
+            , mp_client( p_client )
+            , m_args( args... )
+         { }
+         TRequestAwaiter( const TRequestAwaiter& ) = delete;
+         TRequestAwaiter& operator=( const TRequestAwaiter& ) = delete;
+
+      public:
+         bool await_ready( ) const { return nullptr == mp_proxy; }
+         bool await_suspend( std::coroutine_handle< > handle )
+         {
+            auto handler = [ this, handle ]( const typename TYPES::tEvent* p_event )
+            {
+               // Response is kept by coroutine frame what could be resumed in other os thread.
+               if( nullptr != p_event )
+               {
+                  p_event->share( );
+                  mp_event = typename tResponse::tEventPtr( p_event );
+               }
+               handle.resume( );
+            };
+            auto drop_handler = [ handle ]( ){ handle.destroy( ); };
+
+            const comm::sequence::ID seq_id = std::apply(
+                  [ this, &handler, &drop_handler ]( const auto&... args )
+                  {
+                     return mp_proxy->template request_handler< tRequestData >(
+                           mp_client, std::move( handler ), std::move( drop_handler ), args...
+                        );
+                  },
+                  m_args
+               );
+
+            // Handler is registered only for valid request with response.
+            if( comm::sequence::ID::invalid == seq_id )
+               return false;
+            return TYPES::tEventID::Undefined != tRequestData::RESPONSE;
+         }
+         tResponse await_resume( ) { return tResponse( mp_proxy, std::move( mp_event ) ); }
+
+      private:
+         tProxy*                                      mp_proxy = nullptr;
+         const tClient*                               mp_client = nullptr;
+         std::tuple< std::decay_t< const Args& >... > m_args;
+         typename tResponse::tEventPtr                mp_event = nullptr;
+   };
+
+} // namespace carpc::service::fast::__private__
+
+#endif // __cpp_impl_coroutine
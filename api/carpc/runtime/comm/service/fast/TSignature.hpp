@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include "carpc/runtime/comm/service/Types.hpp"
 
 
@@ -18,9 +20,17 @@ namespace carpc::service::fast {
          TSignature( const TSignature& other );
          ~TSignature( ) = default;
 
+      public:
+         // Signature contains sequence id, so it is unique for almost each request and response.
+         static constexpr bool s_intern = false;
+
       public:
          const std::string dbg_name( ) const;
          bool operator<( const TSignature& ) const;
+         bool operator==( const TSignature& ) const;
+         std::size_t hash( ) const;
+         // Same for request and corresponding response (see 'IAsync::ISignature::flow_id').
+         std::uint64_t flow_id( ) const;
          const bool to_stream( ipc::tStream& ) const;
          const bool from_stream( ipc::tStream& );
 
@@ -91,6 +101,39 @@ namespace carpc::service::fast {
       return m_id < other.m_id;
    }
 
+   template< typename _ID >
+   bool TSignature< _ID >::operator==( const TSignature& other ) const
+   {
+      return m_from == other.m_from
+         && m_to == other.m_to
+         && m_role == other.m_role
+         && m_id == other.m_id
+         && m_seq_id == other.m_seq_id;
+   }
+
+   template< typename _ID >
+   std::size_t TSignature< _ID >::hash( ) const
+   {
+      // Only role and id are hashed because 'from' and 'to' could be wildcards for 'operator<'.
+      std::size_t hash = std::hash< std::string_view >{ }( m_role.value( ) );
+      hash = async::hash_combine( hash, std::hash< std::string_view >{ }( m_id.c_str( ) ) );
+      return hash;
+   }
+
+   template< typename _ID >
+   std::uint64_t TSignature< _ID >::flow_id( ) const
+   {
+      if( comm::sequence::ID::invalid == m_seq_id )
+         return 0;
+
+      // Request is sent from client to server and response from server to client with the same
+      // sequence id, so services are combined symmetrically.
+      using tServiceValue = typename comm::service::ID::VALUE_TYPE;
+      using tSequenceValue = typename comm::sequence::ID::VALUE_TYPE;
+      const std::size_t services = std::hash< tServiceValue >{ }( m_from.value( ) ) ^ std::hash< tServiceValue >{ }( m_to.value( ) );
+      return async::hash_combine( services, std::hash< tSequenceValue >{ }( m_seq_id.value( ) ) );
+   }
+
    template< typename _ID >
    const bool TSignature< _ID >::to_stream( ipc::tStream& stream ) const
    {
@@ -5,6 +5,7 @@
 #include "carpc/runtime/comm/service/secure/TClient.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "TProxySecure"
 
 
@@ -493,7 +494,7 @@ namespace carpc::service::secure::__private__ {
       const comm::sequence::ID seq_id = event.info( ).seq_id( );
       const auto from_context = event.context( );
 
-      SYS_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
+      RT_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
 
       if( true == m_request_processor.response( event ) )
          return;
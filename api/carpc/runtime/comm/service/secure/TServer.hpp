@@ -5,6 +5,7 @@
 #include "carpc/runtime/comm/service/secure/TGenerator.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "TServerSecure"
 
 
@@ -306,7 +307,7 @@ namespace carpc::service::secure::__private__ {
    template< typename TYPES >
    void TServer< TYPES >::process_event( const typename TYPES::tEvent& event )
    {
-      SYS_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
+      RT_VRB( "processing event: %s", event.info( ).dbg_name( ).c_str( ) );
       m_processing_event_id = event.info( ).id( );
 
       if( true == prepare_request( event ) )
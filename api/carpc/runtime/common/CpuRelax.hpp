@@ -0,0 +1,24 @@
+#pragma once
+
+
+
+namespace carpc {
+
+   /*************************
+    *
+    * Hint for CPU what current thread is in spin-wait loop.
+    * Reduces power consumption and releases resources for sibling hyper-thread.
+    *
+    * **********************/
+   inline void cpu_relax( )
+   {
+      #if defined( __x86_64__ ) || defined( __i386__ )
+         __builtin_ia32_pause( );
+      #elif defined( __aarch64__ ) || defined( __arm__ )
+         asm volatile( "yield" ::: "memory" );
+      #else
+         asm volatile( "" ::: "memory" );
+      #endif
+   }
+
+} // namespace carpc
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "carpc/trace/Trace.hpp"
+
+
+
+/*************************
+ *
+ * Trace statements of the runtime hot paths.
+ * Statements with level lower then 'CARPC_RUNTIME_TRACE_LEVEL' are removed by preprocessor,
+ * so neither the statement nor its arguments are compiled.
+ * Statements with enabled level are executed only in case if their level is not lower then
+ * runtime level ('carpc::runtime::trace::level'), and arguments (usually 'dbg_name' of signatures)
+ * are evaluated only in this case.
+ * 'CARPC_RUNTIME_TRACE_LEVEL' is defined by build system (see CMakeLists.txt) and is exported
+ * to targets linked with runtime library, default value is the same as in build system (INFO).
+ *
+ * **********************/
+#define CARPC_RUNTIME_TRACE_LEVEL_VERBOSE    0
+#define CARPC_RUNTIME_TRACE_LEVEL_DEBUG      1
+#define CARPC_RUNTIME_TRACE_LEVEL_INFO       2
+#define CARPC_RUNTIME_TRACE_LEVEL_WARNING    3
+#define CARPC_RUNTIME_TRACE_LEVEL_ERROR      4
+#define CARPC_RUNTIME_TRACE_LEVEL_NONE       5
+
+#ifndef CARPC_RUNTIME_TRACE_LEVEL
+   #define CARPC_RUNTIME_TRACE_LEVEL CARPC_RUNTIME_TRACE_LEVEL_INFO
+#endif
+
+
+
+namespace carpc::runtime::trace {
+
+   enum class eLevel : std::uint8_t
+   {
+      VERBOSE     = CARPC_RUNTIME_TRACE_LEVEL_VERBOSE,
+      DEBUG       = CARPC_RUNTIME_TRACE_LEVEL_DEBUG,
+      INFO        = CARPC_RUNTIME_TRACE_LEVEL_INFO,
+      WARNING     = CARPC_RUNTIME_TRACE_LEVEL_WARNING,
+      ERROR       = CARPC_RUNTIME_TRACE_LEVEL_ERROR,
+      NONE        = CARPC_RUNTIME_TRACE_LEVEL_NONE,
+   };
+
+   namespace __private__ {
+
+      std::atomic< eLevel >& level( );
+
+   }
+
+   // Runtime level. By default it is equal to compile time level.
+   inline eLevel level( )
+   {
+      return __private__::level( ).load( std::memory_order_relaxed );
+   }
+
+   inline void level( const eLevel _level )
+   {
+      __private__::level( ).store( _level, std::memory_order_relaxed );
+   }
+
+   inline bool is_enabled( const eLevel _level )
+   {
+      return _level >= level( );
+   }
+
+} // namespace carpc::runtime::trace
+
+
+
+#define __RT_TRACE__( LEVEL, MACRO, ... ) \
+   do \
+   { \
+      if( carpc::runtime::trace::is_enabled( carpc::runtime::trace::eLevel::LEVEL ) ) \
+         MACRO( __VA_ARGS__ ); \
+   } while( false )
+
+#define __RT_SKIP__( ... ) do { } while( false )
+
+#if CARPC_RUNTIME_TRACE_LEVEL <= CARPC_RUNTIME_TRACE_LEVEL_VERBOSE
+   #define RT_VRB( ... ) __RT_TRACE__( VERBOSE, SYS_VRB, __VA_ARGS__ )
+#else
+   #define RT_VRB( ... ) __RT_SKIP__( __VA_ARGS__ )
+#endif
+
+#if CARPC_RUNTIME_TRACE_LEVEL <= CARPC_RUNTIME_TRACE_LEVEL_DEBUG
+   #define RT_DBG( ... ) __RT_TRACE__( DEBUG, SYS_DBG, __VA_ARGS__ )
+#else
+   #define RT_DBG( ... ) __RT_SKIP__( __VA_ARGS__ )
+#endif
+
+#if CARPC_RUNTIME_TRACE_LEVEL <= CARPC_RUNTIME_TRACE_LEVEL_INFO
+   #define RT_INF( ... ) __RT_TRACE__( INFO, SYS_INF, __VA_ARGS__ )
+#else
+   #define RT_INF( ... ) __RT_SKIP__( __VA_ARGS__ )
+#endif
+
+#if CARPC_RUNTIME_TRACE_LEVEL <= CARPC_RUNTIME_TRACE_LEVEL_WARNING
+   #define RT_WRN( ... ) __RT_TRACE__( WARNING, SYS_WRN, __VA_ARGS__ )
+#else
+   #define RT_WRN( ... ) __RT_SKIP__( __VA_ARGS__ )
+#endif
+
+#if CARPC_RUNTIME_TRACE_LEVEL <= CARPC_RUNTIME_TRACE_LEVEL_ERROR
+   #define RT_ERR( ... ) __RT_TRACE__( ERROR, SYS_ERR, __VA_ARGS__ )
+#else
+   #define RT_ERR( ... ) __RT_SKIP__( __VA_ARGS__ )
+#endif
@@ -0,0 +1,77 @@
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "carpc/runtime/comm/async/AsyncConsumerMap.hpp"
+#include "Events.hpp"
+#include "Scenarios.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchConsMap"
+
+
+
+namespace {
+
+   using namespace carpc::async;
+
+   // Number of events created in advance. Events are spread over all subscribed signatures.
+   const std::size_t s_events = 1024;
+
+   class Consumer : public benchmark::Ping::Consumer
+   {
+      public:
+         void process_event( const benchmark::Ping::Event& ) override { ++m_processed; }
+         std::size_t processed( ) const { return m_processed; }
+
+      private:
+         std::size_t m_processed = 0;
+   };
+
+   void lookup( benchmark::Report& report, const std::size_t subscriptions )
+   {
+      Consumer consumer;
+      AsyncConsumerMap consumer_map( "Benchmark" );
+      for( std::size_t id = 0; id < subscriptions; ++id )
+         consumer_map.set_notification( benchmark::Ping::Signature::create( id ), &consumer );
+
+      std::vector< IAsync::tSptr > events;
+      events.reserve( s_events );
+      for( std::size_t index = 0; index < s_events; ++index )
+         events.emplace_back( benchmark::Ping::Event::create( ( index * 7919 ) % subscriptions )->data( index ) );
+
+      std::atomic< time_t > timestamp = 0;
+      for( const auto& p_event : events )
+         consumer_map.process( p_event, timestamp );
+
+      const std::size_t iterations = report.iterations( );
+      const benchmark::Report::tParams params = { { "subscriptions", std::to_string( subscriptions ) } };
+
+      std::size_t found = 0;
+      std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < iterations; ++index )
+         found += consumer_map.is_subscribed( events[ index % s_events ]->signature( ) ) ? 1 : 0;
+      report.add( "consumer_map.is_subscribed", params, iterations, benchmark::now_ns( ) - begin );
+
+      const std::size_t processed = consumer.processed( );
+      begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < iterations; ++index )
+         consumer_map.process( events[ index % s_events ], timestamp );
+      report.add( "consumer_map.process", params, iterations, benchmark::now_ns( ) - begin );
+
+      if( iterations != found || iterations != consumer.processed( ) - processed )
+         MSG_WRN( "%zu subscriptions: found %zu / processed %zu of %zu", subscriptions, found, consumer.processed( ) - processed, iterations );
+   }
+
+}
+
+
+
+void benchmark::consumer_map( Report& report )
+{
+   if( false == report.is_enabled( "consumer_map" ) )
+      return;
+
+   for( const std::size_t subscriptions : { 10, 100, 1000, 10000 } )
+      lookup( report, subscriptions );
+}
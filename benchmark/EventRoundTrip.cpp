@@ -0,0 +1,123 @@
+#include <string>
+
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+#include "Events.hpp"
+#include "Scenarios.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchEvent"
+
+
+
+namespace {
+
+   using namespace carpc::async;
+   using carpc::application::Context;
+
+   const std::size_t s_loop = 0;
+   const std::size_t s_ping = 1;
+   const std::size_t s_pong = 2;
+
+   /*************************
+    *
+    * 'Bouncer' - replies to each received event by the new event with 'reply' id sent to 'reply_to'.
+    * Initiator (started bouncer) counts received events and completes the token instead of replying
+    * to the last one. Must be created, started and destroyed in its own application thread.
+    *
+    * **********************/
+   class Bouncer : public benchmark::Ping::Consumer
+   {
+      public:
+         Bouncer( const std::size_t receive, const std::size_t reply, const Context& reply_to )
+            : m_reply( reply )
+            , m_reply_to( reply_to )
+         {
+            benchmark::Ping::Event::set_notification( this, receive );
+         }
+
+      public:
+         void start( const std::size_t count, CompletionToken* p_token )
+         {
+            m_remaining = count;
+            mp_token = p_token;
+            send( 0 );
+         }
+
+      private:
+         void process_event( const benchmark::Ping::Event& event ) override
+         {
+            if( nullptr != mp_token && 0 == --m_remaining )
+            {
+               CompletionToken* p_token = mp_token;
+               mp_token = nullptr;
+               p_token->notify( );
+               return;
+            }
+
+            send( *event.data( ) + 1 );
+         }
+
+         void send( const std::size_t sequence )
+         {
+            benchmark::Ping::Event::create( m_reply )->data( sequence )->send( m_reply_to );
+         }
+
+      private:
+         const std::size_t    m_reply;
+         const Context        m_reply_to;
+         std::size_t          m_remaining = 0;
+         CompletionToken*     mp_token = nullptr;
+   };
+
+   Bouncer* create_bouncer( const Context& context, const std::size_t receive, const std::size_t reply, const Context& reply_to )
+   {
+      return Runnable::call( context, [ & ]( ){ return new Bouncer( receive, reply, reply_to ); } );
+   }
+
+   void destroy_bouncer( const Context& context, Bouncer* p_bouncer )
+   {
+      Runnable::call( context, [ p_bouncer ]( ){ delete p_bouncer; } );
+   }
+
+   std::uint64_t run( const Context& context, Bouncer* p_initiator, const std::size_t count )
+   {
+      CompletionToken token;
+      const std::uint64_t begin = benchmark::now_ns( );
+      Runnable::call( context, [ & ]( ){ p_initiator->start( count, &token ); } );
+      token.wait( );
+      return benchmark::now_ns( ) - begin;
+   }
+
+   void round_trip( benchmark::Report& report, const Context& initiator_context, const Context& responder_context )
+   {
+      const bool is_same_thread = initiator_context == responder_context;
+      const std::size_t count = report.iterations( );
+
+      Bouncer* p_responder = is_same_thread ? nullptr : create_bouncer( responder_context, s_ping, s_pong, initiator_context );
+      Bouncer* p_initiator = is_same_thread
+         ? create_bouncer( initiator_context, s_loop, s_loop, initiator_context )
+         : create_bouncer( initiator_context, s_pong, s_ping, responder_context );
+
+      // Warm up: pools of events and signatures are filled, threads are woken up.
+      run( initiator_context, p_initiator, count / 10 + 1 );
+      const std::uint64_t elapsed_ns = run( initiator_context, p_initiator, count );
+
+      destroy_bouncer( initiator_context, p_initiator );
+      if( p_responder )
+         destroy_bouncer( responder_context, p_responder );
+
+      report.add( "event.round_trip", { { "threads", is_same_thread ? "1" : "2" } }, count, elapsed_ns );
+   }
+
+}
+
+
+
+void benchmark::event( Report& report, const Contexts& contexts )
+{
+   if( false == report.is_enabled( "event.round_trip" ) )
+      return;
+
+   round_trip( report, contexts.first, contexts.first );
+   round_trip( report, contexts.first, contexts.second );
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "carpc/runtime/comm/async/event/Event.hpp"
+
+
+
+namespace benchmark {
+
+   // Event used by all event based scenarios. Its IPC form is used for packet serialization.
+   // Signature id distinguishes subscriptions, data is sequence number of the event.
+   DEFINE_IPC_EVENT( Ping, std::size_t, carpc::async::id::TSignature< std::size_t > );
+
+} // namespace benchmark
@@ -0,0 +1,82 @@
+#include <string>
+
+#include "carpc/runtime/common/Packet.hpp"
+#include "Events.hpp"
+#include "Scenarios.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchPacket"
+
+
+
+namespace {
+
+   using namespace carpc;
+
+   std::uint64_t measure_serialize( const async::IEvent& event, const application::Context& to_context, const std::size_t count )
+   {
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+      {
+         ipc::tStream stream;
+         ipc::serialize( stream, ipc::Packet( ipc::eCommand::IpcEvent, event, to_context ) );
+      }
+      return benchmark::now_ns( ) - begin;
+   }
+
+   // Deserialization is done in the same way as it is done for received IPC packets (see 'SendReceive').
+   std::uint64_t measure_deserialize( const ipc::tStream& source, const std::size_t count )
+   {
+      std::size_t received = 0;
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+      {
+         ipc::tStream stream( source.buffer( ), source.size( ) );
+         ipc::Packet packet;
+         ipc::deserialize( stream, packet );
+         for( ipc::Package& package : packet.packages( ) )
+         {
+            async::IEvent::tSptr p_event = async::IEvent::deserialize( package.data( ) );
+            application::Context to_context = application::Context::invalid;
+            if( nullptr != p_event && package.data( to_context ) )
+               ++received;
+         }
+      }
+      const std::uint64_t elapsed_ns = benchmark::now_ns( ) - begin;
+
+      if( count != received )
+         MSG_WRN( "deserialized %zu of %zu events", received, count );
+      return elapsed_ns;
+   }
+
+}
+
+
+
+void benchmark::packet( Report& report )
+{
+   if( false == report.is_enabled( "packet" ) )
+      return;
+
+   // Event type must be registered to be created during deserialization.
+   REGISTER_EVENT( benchmark::Ping );
+
+   const std::size_t count = report.iterations( );
+   const application::Context to_context = application::Context::internal_broadcast;
+   const async::IEvent::tSptr p_event = benchmark::Ping::Event::create( std::size_t{ 1 } )->data( 42 );
+
+   ipc::tStream source;
+   ipc::serialize( source, ipc::Packet( ipc::eCommand::IpcEvent, *p_event, to_context ) );
+   const Report::tParams params = { { "bytes", std::to_string( source.size( ) ) } };
+
+   if( report.is_enabled( "packet.serialize" ) )
+   {
+      measure_serialize( *p_event, to_context, count / 10 + 1 );
+      report.add( "packet.serialize", params, count, measure_serialize( *p_event, to_context, count ) );
+   }
+   if( report.is_enabled( "packet.deserialize" ) )
+   {
+      measure_deserialize( source, count / 10 + 1 );
+      report.add( "packet.deserialize", params, count, measure_deserialize( source, count ) );
+   }
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+#include "Scenarios.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchQueue"
+
+
+
+namespace {
+
+   using namespace carpc::async;
+
+   void push_pop( benchmark::Report& report, const eAsyncQueueType type, const std::size_t producers, const std::size_t batch_size )
+   {
+      const std::size_t per_producer = report.iterations( ) / producers + 1;
+      const std::size_t total = per_producer * producers;
+
+      IAsyncQueue::tSptr p_queue = IAsyncQueue::create( "Benchmark", { type } );
+      if( nullptr == p_queue )
+         return;
+
+      // The same async object is inserted by all producers, so only the queue itself is measured.
+      // Handles are copied by producer threads, so references must be counted atomically.
+      const IAsync::tSptr p_async = Runnable::create( []( ){ } );
+      p_async->share( );
+
+      std::atomic< bool > is_started = false;
+      std::vector< std::thread > threads;
+      threads.reserve( producers );
+      for( std::size_t index = 0; index < producers; ++index )
+      {
+         threads.emplace_back( [ &is_started, &p_queue, &p_async, per_producer ]( )
+            {
+               while( false == is_started.load( std::memory_order_acquire ) )
+                  std::this_thread::yield( );
+               for( std::size_t count = 0; count < per_producer; ++count )
+                  p_queue->insert( p_async );
+            }
+         );
+      }
+
+      // Calling thread is the only consumer of the queue.
+      IAsyncQueue::tBatch batch;
+      batch.reserve( batch_size );
+      std::size_t extracted = 0;
+
+      const std::uint64_t begin = benchmark::now_ns( );
+      is_started.store( true, std::memory_order_release );
+      while( extracted < total )
+      {
+         if( 1 == batch_size )
+         {
+            p_queue->get( );
+            ++extracted;
+         }
+         else
+         {
+            extracted += p_queue->get_batch( batch, batch_size );
+            batch.clear( );
+         }
+      }
+      const std::uint64_t elapsed_ns = benchmark::now_ns( ) - begin;
+
+      for( auto& thread : threads )
+         thread.join( );
+
+      report.add( "queue.push_pop",
+            {
+               { "queue", c_str( type ) },
+               { "producers", std::to_string( producers ) },
+               { "batch", std::to_string( batch_size ) }
+            },
+            total, elapsed_ns
+         );
+   }
+
+}
+
+
+
+void benchmark::queue( Report& report )
+{
+   if( false == report.is_enabled( "queue.push_pop" ) )
+      return;
+
+   const std::size_t max_producers = std::max( 4u, std::thread::hardware_concurrency( ) );
+
+   for( const auto type : { eAsyncQueueType::FIFO, eAsyncQueueType::PRIORITY, eAsyncQueueType::LOCK_FREE, eAsyncQueueType::DEADLINE } )
+      for( std::size_t producers = 1; producers <= max_producers; producers *= 2 )
+         for( const std::size_t batch_size : { 1, 32 } )
+            push_pop( report, type, producers, batch_size );
+}
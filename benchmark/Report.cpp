@@ -0,0 +1,84 @@
+#include <chrono>
+
+#include "Report.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchReport"
+
+
+
+using namespace benchmark;
+
+
+
+std::uint64_t benchmark::now_ns( )
+{
+   return std::chrono::duration_cast< std::chrono::nanoseconds >(
+         std::chrono::steady_clock::now( ).time_since_epoch( )
+      ).count( );
+}
+
+
+
+Report::Report( const std::string& file_name, const std::string& filter, const std::size_t iterations )
+   : mp_file( file_name.empty( ) ? stdout : fopen( file_name.c_str( ), "w" ) )
+   , m_is_owner( false == file_name.empty( ) )
+   , m_filter( filter )
+   , m_iterations( 0 == iterations ? 1 : iterations )
+{
+   if( nullptr == mp_file )
+   {
+      MSG_ERR( "unable to open '%s', results will be written to stdout", file_name.c_str( ) );
+      mp_file = stdout;
+   }
+}
+
+Report::~Report( )
+{
+   if( m_is_owner && stdout != mp_file )
+      fclose( mp_file );
+}
+
+bool Report::is_enabled( const std::string& name ) const
+{
+   return m_filter.empty( )
+      || std::string::npos != name.find( m_filter )
+      || 0 == m_filter.compare( 0, name.size( ), name );
+}
+
+std::string Report::escape( const std::string& value )
+{
+   std::string result;
+   result.reserve( value.size( ) );
+   for( const char symbol : value )
+   {
+      if( '"' == symbol || '\\' == symbol )
+         result.push_back( '\\' );
+      result.push_back( symbol );
+   }
+   return result;
+}
+
+void Report::add( const std::string& name, const tParams& params, const std::size_t iterations, const std::uint64_t elapsed_ns )
+{
+   const double ns_per_op = 0 == iterations ? 0.0 : static_cast< double >( elapsed_ns ) / static_cast< double >( iterations );
+   const double ops_per_sec = 0 == elapsed_ns ? 0.0 : static_cast< double >( iterations ) * 1e9 / static_cast< double >( elapsed_ns );
+
+   std::string json_params;
+   for( const auto& param : params )
+   {
+      if( false == json_params.empty( ) )
+         json_params += ", ";
+      json_params += "\"" + escape( param.first ) + "\": \"" + escape( param.second ) + "\"";
+   }
+
+   fprintf( mp_file,
+         "{ \"name\": \"%s\", \"params\": { %s }, \"iterations\": %zu, \"elapsed_ns\": %llu, \"ns_per_op\": %.2f, \"ops_per_sec\": %.0f }\n",
+         escape( name ).c_str( ), json_params.c_str( ), iterations,
+         static_cast< unsigned long long >( elapsed_ns ), ns_per_op, ops_per_sec
+      );
+   fflush( mp_file );
+   ++m_count;
+
+   MSG_INF( "%s: %zu iterations, %.2f ns/op", name.c_str( ), iterations, ns_per_op );
+}
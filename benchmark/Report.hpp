@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+
+namespace benchmark {
+
+   /*************************
+    *
+    * 'Report' - collects results of benchmark scenarios in machine-readable form.
+    * Each result is written as separate JSON object on its own line (JSON Lines) immediately
+    * after the measurement, so results could be consumed even in case if some scenario hangs:
+    *    { "name": "consumer_map.process", "params": { "subscriptions": "1000" },
+    *      "iterations": 100000, "elapsed_ns": 8123456, "ns_per_op": 81.23, "ops_per_sec": 12310000 }
+    * Results are written to the file or to stdout in case if file name is empty.
+    * Scenario is executed only in case if its name contains 'filter' or 'filter' starts with its name,
+    * so both "map" and "consumer_map.process" select "consumer_map" scenario (empty filter - all scenarios).
+    *
+    * **********************/
+   class Report
+   {
+      public:
+         using tParams = std::vector< std::pair< std::string, std::string > >;
+
+      public:
+         Report( const std::string& file_name, const std::string& filter, const std::size_t iterations );
+         ~Report( );
+         Report( const Report& ) = delete;
+         Report& operator=( const Report& ) = delete;
+
+      public:
+         bool is_enabled( const std::string& name ) const;
+         void add( const std::string& name, const tParams& params, const std::size_t iterations, const std::uint64_t elapsed_ns );
+
+      public:
+         // Base number of iterations for each scenario. Scenarios scale it according to the cost of operation.
+         std::size_t iterations( ) const;
+         std::size_t count( ) const;
+
+      private:
+         static std::string escape( const std::string& );
+
+      private:
+         FILE*                mp_file = nullptr;
+         const bool           m_is_owner = false;
+         const std::string    m_filter;
+         const std::size_t    m_iterations = 0;
+         std::size_t          m_count = 0;
+   };
+
+
+
+   inline
+   std::size_t Report::iterations( ) const
+   {
+      return m_iterations;
+   }
+
+   inline
+   std::size_t Report::count( ) const
+   {
+      return m_count;
+   }
+
+   // Current steady clock time in nanoseconds.
+   std::uint64_t now_ns( );
+
+} // namespace benchmark
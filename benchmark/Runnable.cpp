@@ -0,0 +1,168 @@
+#include <functional>
+#include <string>
+#include <tuple>
+
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+#include "carpc/runtime/comm/async/callable/TCallable.hpp"
+#include "Scenarios.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchRunnable"
+
+
+
+namespace {
+
+   using namespace carpc::async;
+   using carpc::application::Context;
+
+   // State of dispatching series. It is modified only by destination thread.
+   struct Series
+   {
+      const std::size_t    count;
+      std::size_t          processed = 0;
+      CompletionToken      token;
+   };
+
+   void on_processed( Series* p_series )
+   {
+      if( ++p_series->processed == p_series->count )
+         p_series->token.notify( );
+   }
+
+   std::uint64_t runnable_send( const Context& context, const std::size_t count )
+   {
+      Series series{ count };
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+         Runnable::create_send( [ p_series = &series ]( ){ on_processed( p_series ); }, context );
+      series.token.wait( );
+      return benchmark::now_ns( ) - begin;
+   }
+
+   std::uint64_t callable_send( const Context& context, const std::size_t count )
+   {
+      Series series{ count };
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+         callable::create_send( context, on_processed, &series );
+      series.token.wait( );
+      return benchmark::now_ns( ) - begin;
+   }
+
+   void increment( std::size_t* p_counter )
+   {
+      ++*p_counter;
+   }
+
+   // Creation and call of callable object in the calling thread: cost of allocation and invocation
+   // without queueing and waking up of destination thread.
+   std::uint64_t callable_create_call( const Context&, const std::size_t count )
+   {
+      std::size_t counter = 0;
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+         callable::create( increment, &counter )->call( );
+      const std::uint64_t elapsed_ns = benchmark::now_ns( ) - begin;
+
+      if( count != counter )
+         MSG_WRN( "called %zu of %zu callable objects", counter, count );
+      return elapsed_ns;
+   }
+
+// Previous implementation of callable object is compiled in the same way as it was compiled
+// in 'TCallable.hpp' before storing function and arguments inline.
+#pragma GCC push_options
+#pragma GCC optimize ("O0")
+
+   // Previous implementation of callable object: function is stored as 'std::function',
+   // object is allocated by 'new' and its control block separately by 'std::shared_ptr'.
+   template< typename ...Args >
+   class FunctionCallable : public ICallable
+   {
+      public:
+         using tFunction = std::function< void( Args... ) >;
+         using tParameters = std::tuple< Args... >;
+
+      private:
+         FunctionCallable( tFunction function, Args&... args )
+            : m_function( function )
+            , m_params( args... )
+         { }
+
+      public:
+         static tSptr const create( tFunction function, Args&... args )
+         {
+            return std::shared_ptr< FunctionCallable >( new FunctionCallable( function, args... ) );
+         }
+
+      public:
+         void call( ) const override
+         {
+            std::apply( m_function, m_params );
+         }
+
+      private:
+         const tFunction         m_function;
+         const tParameters       m_params;
+   };
+
+#pragma GCC pop_options
+
+   // The same as 'callable_create_call' but for previous implementation of callable object.
+   std::uint64_t function_callable_create_call( const Context&, const std::size_t count )
+   {
+      std::size_t counter = 0;
+      std::size_t* p_counter = &counter;
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+         FunctionCallable< std::size_t* >::create( increment, p_counter )->call( );
+      const std::uint64_t elapsed_ns = benchmark::now_ns( ) - begin;
+
+      if( count != counter )
+         MSG_WRN( "called %zu of %zu callable objects", counter, count );
+      return elapsed_ns;
+   }
+
+   std::uint64_t runnable_call( const Context& context, const std::size_t count )
+   {
+      std::size_t processed = 0;
+      const std::uint64_t begin = benchmark::now_ns( );
+      for( std::size_t index = 0; index < count; ++index )
+         processed = Runnable::call( context, [ &processed ]( ){ return processed + 1; } );
+      const std::uint64_t elapsed_ns = benchmark::now_ns( ) - begin;
+
+      if( count != processed )
+         MSG_WRN( "processed %zu of %zu calls", processed, count );
+      return elapsed_ns;
+   }
+
+   using tScenario = std::uint64_t (*)( const Context&, const std::size_t );
+
+   void measure(
+         benchmark::Report& report, const std::string& name, tScenario scenario,
+         const Context& context, const std::size_t count, const char* threads = "2"
+      )
+   {
+      if( false == report.is_enabled( name ) )
+         return;
+
+      // Warm up: pools of runnable and callable objects are filled, thread is woken up.
+      scenario( context, count / 10 + 1 );
+      report.add( name, { { "threads", threads } }, count, scenario( context, count ) );
+   }
+
+}
+
+
+
+void benchmark::runnable( Report& report, const Contexts& contexts )
+{
+   measure( report, "runnable.send", runnable_send, contexts.first, report.iterations( ) );
+   measure( report, "callable.send", callable_send, contexts.first, report.iterations( ) );
+   measure( report, "callable.create_call", callable_create_call, contexts.first, report.iterations( ), "1" );
+   // Baseline for 'callable.create_call'.
+   measure( report, "callable.function.create_call", function_callable_create_call, contexts.first, report.iterations( ), "1" );
+   // Synchronous call waits for each result, so it is much more expensive then sending.
+   measure( report, "runnable.call", runnable_call, contexts.first, report.iterations( ) / 10 + 1 );
+}
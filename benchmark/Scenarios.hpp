@@ -0,0 +1,31 @@
+#pragma once
+
+#include "carpc/runtime/application/Context.hpp"
+#include "Report.hpp"
+
+
+
+namespace benchmark {
+
+   // Application threads used by scenarios what require running runtime.
+   // Scenarios are executed by separate 'Benchmark' thread, so these threads are never blocked.
+   struct Contexts
+   {
+      carpc::application::Context   first;
+      carpc::application::Context   second;
+   };
+
+   // 'IAsyncQueue' implementations: insert by 1..N producer threads / extraction by single consumer.
+   void queue( Report& );
+   // 'AsyncConsumerMap': lookup and dispatching of event to its consumer with 10..10k subscriptions.
+   void consumer_map( Report& );
+   // 'TEvent': create + send + process round trip in the same thread and between two threads.
+   void event( Report&, const Contexts& );
+   // 'Runnable' / 'TCallable': dispatching to application thread and synchronous call.
+   void runnable( Report&, const Contexts& );
+   // 'ipc::Packet': serialization / deserialization of packet with IPC event.
+   void packet( Report& );
+   // 'fast::TProxy' => 'fast::TServer': request / response round trip between two threads.
+   void service( Report&, const Contexts& );
+
+} // namespace benchmark
@@ -0,0 +1,218 @@
+#include <string>
+
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+#include "carpc/runtime/comm/service/fast/TServer.hpp"
+#include "carpc/runtime/comm/service/fast/TClient.hpp"
+#include "Scenarios.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "BenchService"
+
+
+
+namespace {
+
+   using namespace carpc;
+   using async::CompletionToken;
+
+   const char* const s_role = "Benchmark";
+
+
+
+   // Identifiers of service events.
+   class eID
+   {
+      public:
+         enum eValue : std::uint8_t { RequestEcho, RequestEchoBusy, ResponseEcho, UNDEFINED };
+         static const eID Undefined;
+
+      public:
+         eID( ) = default;
+         eID( const eValue value ) : m_value( value ) { }
+
+      public:
+         bool operator==( const eID& other ) const { return m_value == other.m_value; }
+         bool operator!=( const eID& other ) const { return m_value != other.m_value; }
+         bool operator<( const eID& other ) const { return m_value < other.m_value; }
+
+         bool to_stream( ipc::tStream& stream ) const { return ipc::serialize( stream, m_value ); }
+         bool from_stream( ipc::tStream& stream ) { return ipc::deserialize( stream, m_value ); }
+
+         const char* c_str( ) const
+         {
+            switch( m_value )
+            {
+               case RequestEcho:       return "eID::RequestEcho";
+               case RequestEchoBusy:   return "eID::RequestEchoBusy";
+               case ResponseEcho:      return "eID::ResponseEcho";
+               default:                return "eID::UNDEFINED";
+            }
+         }
+
+      private:
+         eValue m_value = UNDEFINED;
+   };
+   const eID eID::Undefined = eID::UNDEFINED;
+
+
+
+   struct BaseData
+   {
+      virtual ~BaseData( ) = default;
+   };
+
+   struct EchoRequestData : public BaseData
+   {
+      static const eID REQUEST;
+      static const eID BUSY;
+      static const eID RESPONSE;
+
+      EchoRequestData( const std::size_t _value ) : value( _value ) { }
+
+      std::size_t value = 0;
+   };
+   const eID EchoRequestData::REQUEST = eID::RequestEcho;
+   const eID EchoRequestData::BUSY = eID::RequestEchoBusy;
+   const eID EchoRequestData::RESPONSE = eID::ResponseEcho;
+
+   struct EchoResponseData : public BaseData
+   {
+      static const eID REQUEST;
+      static const eID RESPONSE;
+
+      EchoResponseData( const std::size_t _value ) : value( _value ) { }
+
+      std::size_t value = 0;
+   };
+   const eID EchoResponseData::REQUEST = eID::RequestEcho;
+   const eID EchoResponseData::RESPONSE = eID::ResponseEcho;
+
+
+
+   // In-process service: request and response are delivered as events without serialization.
+   struct EchoTypes
+   {
+      using tIPC = carpc::NO_IPC;
+      using tID = eID;
+      using tBaseData = BaseData;
+
+      static const service::RequestResponseIDs< eID >::tVector RR;
+      static const service::NotificationIDs< eID >::tVector N;
+   };
+   const service::RequestResponseIDs< eID >::tVector EchoTypes::RR = {
+      { eID::RequestEcho, eID::RequestEchoBusy, eID::ResponseEcho }
+   };
+   const service::NotificationIDs< eID >::tVector EchoTypes::N = { };
+
+   using tEvent = service::fast::TGenerator< EchoTypes >::tEvent;
+
+
+
+   class EchoServer : public service::fast::TServer< EchoTypes >
+   {
+      public:
+         EchoServer( ) : service::fast::TServer< EchoTypes >( s_role, false ) { }
+
+      private:
+         void connected( ) override { }
+         void disconnected( ) override { }
+
+         void process_request_event( const tEvent& event ) override
+         {
+            if( const EchoRequestData* p_data = get_event_data< EchoRequestData >( event ) )
+               response< EchoResponseData >( p_data->value );
+         }
+   };
+
+   /*************************
+    *
+    * 'EchoClient' - sends next request after receiving response to the previous one and completes
+    * the token after receiving 'count' responses.
+    * Client must be created before the server: already connected proxy notifies the client
+    * from the constructor of client base class, where 'connected' of this class can't be called yet.
+    *
+    * **********************/
+   class EchoClient : public service::fast::TClient< EchoTypes >
+   {
+      public:
+         EchoClient( CompletionToken* p_connected )
+            : service::fast::TClient< EchoTypes >( s_role, false )
+            , mp_connected( p_connected )
+         {
+         }
+
+      public:
+         void start( const std::size_t count, CompletionToken* p_token )
+         {
+            m_remaining = count;
+            mp_token = p_token;
+            request< EchoRequestData >( this, std::size_t{ 0 } );
+         }
+
+      private:
+         void connected( ) override
+         {
+            if( nullptr == mp_connected )
+               return;
+
+            CompletionToken* p_connected = mp_connected;
+            mp_connected = nullptr;
+            p_connected->notify( );
+         }
+         void disconnected( ) override { }
+
+         void process_response_event( const tEvent& event ) override
+         {
+            const EchoResponseData* p_data = get_event_data< EchoResponseData >( event );
+            if( nullptr != mp_token && 0 == --m_remaining )
+            {
+               CompletionToken* p_token = mp_token;
+               mp_token = nullptr;
+               p_token->notify( );
+               return;
+            }
+
+            request< EchoRequestData >( this, nullptr != p_data ? p_data->value + 1 : 0 );
+         }
+         void process_notification_event( const tEvent& ) override { }
+
+      private:
+         CompletionToken*     mp_connected = nullptr;
+         std::size_t          m_remaining = 0;
+         CompletionToken*     mp_token = nullptr;
+   };
+
+   std::uint64_t run( const application::Context& context, EchoClient* p_client, const std::size_t count )
+   {
+      CompletionToken token;
+      const std::uint64_t begin = benchmark::now_ns( );
+      async::Runnable::call( context, [ & ]( ){ p_client->start( count, &token ); } );
+      token.wait( );
+      return benchmark::now_ns( ) - begin;
+   }
+
+}
+
+
+
+void benchmark::service( Report& report, const Contexts& contexts )
+{
+   if( false == report.is_enabled( "service.request_response" ) )
+      return;
+
+   const std::size_t count = report.iterations( ) / 10 + 1;
+
+   CompletionToken connected;
+   EchoClient* p_client = async::Runnable::call( contexts.first, [ & ]( ){ return new EchoClient( &connected ); } );
+   EchoServer* p_server = async::Runnable::call( contexts.second, [ ]( ){ return new EchoServer( ); } );
+   connected.wait( );
+
+   // Warm up: request processors and pools are filled, threads are woken up.
+   run( contexts.first, p_client, count / 10 + 1 );
+   const std::uint64_t elapsed_ns = run( contexts.first, p_client, count );
+
+   async::Runnable::call( contexts.first, [ p_client ]( ){ delete p_client; } );
+   async::Runnable::call( contexts.second, [ p_server ]( ){ delete p_server; } );
+
+   report.add( "service.request_response", { { "threads", "2" } }, count, elapsed_ns );
+}
@@ -0,0 +1,91 @@
+#include "carpc/runtime/application/main.hpp"
+#include "carpc/runtime/application/RootComponent.hpp"
+#include "Scenarios.hpp"
+
+
+
+/****************************************************************************************************
+ *
+ * Microbenchmarks of runtime hot paths.
+ * Scenarios are executed one by one by 'Benchmark' thread during booting of the application,
+ * threads 'BenchmarkFirst' and 'BenchmarkSecond' are used as destinations of async objects.
+ * After all scenarios are finished application is shut down.
+ * Parameters:
+ *    benchmark_output     - file for results in JSON Lines format (default: stdout).
+ *    benchmark_filter     - run only scenarios what match the filter (see 'benchmark::Report').
+ *    benchmark_iterations - base number of iterations for each scenario (default: 100000).
+ * Trace output should be redirected (see 'trace_log' parameter) in case if results are written to stdout.
+ *
+ ***************************************************************************************************/
+namespace benchmark {
+
+   class Benchmark : public carpc::application::RootComponent
+   {
+      public:
+         static carpc::application::IComponent::tSptr creator( )
+         {
+            return std::shared_ptr< Benchmark >( new Benchmark( "Benchmark" ) );
+         }
+
+      private:
+         Benchmark( const std::string& name ) : RootComponent( name ) { }
+      public:
+         ~Benchmark( ) override = default;
+
+      private:
+         void process_boot( const std::string& ) override;
+   };
+
+
+
+   void Benchmark::process_boot( const std::string& )
+   {
+      carpc::application::Process::tSptr p_process = carpc::application::Process::instance( );
+      const carpc::tools::parameters::Params& params = p_process->parameters( );
+
+      Report report(
+            params.value_or( "benchmark_output", "" ),
+            params.value_or( "benchmark_filter", "" ),
+            static_cast< std::size_t >( std::stoll( params.value_or( "benchmark_iterations", "100000" ) ) )
+         );
+
+      carpc::application::IThread::tSptr p_first = p_process->thread( "BenchmarkFirst" );
+      carpc::application::IThread::tSptr p_second = p_process->thread( "BenchmarkSecond" );
+      if( nullptr == p_first || nullptr == p_second )
+      {
+         MSG_ERR( "benchmark threads are not found" );
+         shutdown( );
+         return;
+      }
+      const Contexts contexts{
+            carpc::application::Context( p_first->id( ) ),
+            carpc::application::Context( p_second->id( ) )
+         };
+
+      queue( report );
+      consumer_map( report );
+      event( report, contexts );
+      runnable( report, contexts );
+      packet( report );
+      service( report, contexts );
+
+      MSG_INF( "finished: %zu results", report.count( ) );
+      shutdown( );
+   }
+
+} // namespace benchmark
+
+
+
+// Watchdog is disabled for all threads, because 'Benchmark' thread is blocked by scenarios during booting.
+const carpc::application::Thread::Configuration::tVector services =
+{
+   { "Benchmark", { benchmark::Benchmark::creator }, 0 },
+   { "BenchmarkFirst", { }, 0 },
+   { "BenchmarkSecond", { }, 0 },
+};
+
+bool test( int argc, char** argv, char** envp )
+{
+   return true;
+}
@@ -0,0 +1,10 @@
+#include "carpc/runtime/application/IThread.hpp"
+
+
+
+using namespace carpc::application;
+
+
+
+thread_local IThread::tRptr IThread::sp_current = nullptr;
+thread_local bool IThread::s_is_worker = false;
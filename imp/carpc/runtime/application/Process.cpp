@@ -8,6 +8,7 @@
 #include "carpc/runtime/application/Thread.hpp"
 #include "carpc/runtime/application/ThreadIPC.hpp"
 #include "carpc/runtime/application/Process.hpp"
+#include "carpc/runtime/comm/async/Timeline.hpp"
 #include "carpc/runtime/events/Events.hpp"
 
 #include "carpc/trace/Trace.hpp"
@@ -41,6 +42,13 @@ namespace {
       process_watchdog( );
    }
 
+   void metrics_timer_handler( union sigval sv )
+   {
+      carpc::application::Process::tRptr p_process = carpc::application::Process::raw_instance( );
+      if( nullptr != p_process )
+         p_process->dump_metrics( );
+   }
+
    void signal_handler( int signal, siginfo_t* si, void* uc )
    {
       carpc::os::os_linux::timer::tID* timer_id = static_cast< carpc::os::os_linux::timer::tID* >( si->si_value.sival_ptr );
@@ -119,6 +127,12 @@ Process::Process( int argc, char** argv, char** envp )
    m_configuration.wd_timout = static_cast< std::size_t >(
          std::stoll( m_params.value_or( "application_wd_timout", "10" ) )
       );
+   m_configuration.metrics_period = static_cast< std::size_t >(
+         std::stoll( m_params.value_or( "application_metrics_period", "0" ) )
+      );
+   m_configuration.timeline_file = m_params.value_or( "application_timeline_file", "" );
+   if( false == m_configuration.timeline_file.empty( ) )
+      async::timeline::enable( true );
 
    DUMP_IPC_EVENTS;
 
@@ -155,38 +169,65 @@ IThread::tSptr Process::thread_ipc( ) const
 
 IThread::tSptr Process::thread( const thread::ID& id ) const
 {
-   for( auto& p_thread : m_thread_list )
-   {
-      if( id == p_thread->id( ) )
-         return p_thread;
-   }
+   const auto iterator = m_thread_id_index.find( id.value( ) );
+   if( m_thread_id_index.end( ) == iterator )
+      return nullptr;
 
-   return nullptr;
+   return m_thread_registry[ iterator->second ]->shared_from_this( );
 }
 
 IThread::tSptr Process::thread( const std::string& name ) const
 {
-   for( auto& p_thread : m_thread_list )
-   {
-      if( p_thread->name( ) == name )
-         return p_thread;
-   }
+   const auto iterator = m_thread_name_index.find( name );
+   if( m_thread_name_index.end( ) == iterator )
+      return nullptr;
 
-   return nullptr;
+   return m_thread_registry[ iterator->second ]->shared_from_this( );
 }
 
-IThread::tSptr Process::current_thread( ) const
+void Process::index_threads( )
 {
-   for( auto& p_thread : m_thread_list )
+   m_thread_registry.clear( );
+   m_thread_id_index.clear( );
+   m_thread_name_index.clear( );
+
+   m_thread_registry.reserve( m_thread_list.size( ) );
+   m_thread_id_index.reserve( m_thread_list.size( ) );
+   m_thread_name_index.reserve( m_thread_list.size( ) );
+   for( const auto& p_thread : m_thread_list )
    {
-      if( p_thread && os::Thread::current_id( ) == p_thread->thread( ).id( ) )
-         return p_thread;
+      const std::size_t index = m_thread_registry.size( );
+      m_thread_registry.push_back( p_thread.get( ) );
+      // In case of duplicated names or ids the first thread is found as it was with linear search.
+      m_thread_id_index.emplace( p_thread->id( ).value( ), index );
+      m_thread_name_index.emplace( p_thread->name( ).c_str( ), index );
    }
+}
+
+std::vector< carpc::async::metrics::Snapshot > Process::metrics( ) const
+{
+   std::vector< async::metrics::Snapshot > snapshots;
+   snapshots.reserve( m_thread_list.size( ) + 1 );
+   if( nullptr != mp_thread_ipc )
+      snapshots.emplace_back( mp_thread_ipc->metrics( ) );
+   for( const auto& p_thread : m_thread_list )
+      snapshots.emplace_back( p_thread->metrics( ) );
+   return snapshots;
+}
 
-   if( mp_thread_ipc && os::Thread::current_id( ) == mp_thread_ipc->thread( ).id( ) )
-      return mp_thread_ipc;
+void Process::dump_metrics( ) const
+{
+   for( const auto& snapshot : metrics( ) )
+      snapshot.dump( );
+}
 
-   return nullptr;
+IThread::tSptr Process::current_thread( ) const
+{
+   IThread::tRptr p_thread = IThread::current( );
+   if( nullptr == p_thread )
+      return nullptr;
+
+   return p_thread->shared_from_this( );
 }
 
 bool Process::start( const Thread::Configuration::tVector& thread_configs )
@@ -229,6 +270,7 @@ bool Process::start( const Thread::Configuration::tVector& thread_configs )
          return false;
       m_thread_list.emplace_back( p_thread );
    }
+   index_threads( );
 
    // Starting application threads
    for( const auto& p_thread : m_thread_list )
@@ -271,6 +313,15 @@ bool Process::start( const Thread::Configuration::tVector& thread_configs )
       SYS_WRN( "[runtime] watchdog disabled" );
    }
 
+   // Metrics timer
+   if( 0 < m_configuration.metrics_period )
+   {
+      if( false == os::os_linux::timer::create( m_metrics_timer_id, metrics_timer_handler, &m_metrics_timer_id ) )
+         return false;
+      if( false == os::os_linux::timer::start( m_metrics_timer_id, m_configuration.metrics_period * 1000000000, os::os_linux::timer::eTimerType::continious ) )
+         return false;
+   }
+
    SYS_DBG( "[runtime] started" );
    return true;
 }
@@ -279,15 +330,19 @@ bool Process::stop( )
 {
    SYS_DBG( "[runtime] stopping" );
 
+   // Timer handlers iterate the list of threads, so timers are removed before the list is cleared.
+   os::os_linux::timer::remove( m_timer_id );
+   if( 0 < m_configuration.metrics_period )
+      os::os_linux::timer::remove( m_metrics_timer_id );
+
    for( auto& p_thread : m_thread_list )
       if( p_thread )
          p_thread->stop( );
    m_thread_list.clear( );
+   index_threads( );
    if( mp_thread_ipc )
       mp_thread_ipc->stop( );
 
-   os::os_linux::timer::remove( m_timer_id );
-
    SYS_DBG( "[runtime] stopped" );
    return true;
 }
@@ -308,7 +363,12 @@ void Process::boot( )
       mp_thread_ipc->wait( );
    SYS_DBG( "[runtime] IPC thread is stopped" );
 
+   if( false == m_configuration.timeline_file.empty( ) )
+      async::timeline::flush( m_configuration.timeline_file );
+
    os::os_linux::timer::remove( m_timer_id );
+   if( 0 < m_configuration.metrics_period )
+      os::os_linux::timer::remove( m_metrics_timer_id );
 
    m_thread_list.clear( );
    mp_thread_ipc.reset( );
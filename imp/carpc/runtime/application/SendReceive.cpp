@@ -1,4 +1,5 @@
 #include "carpc/runtime/comm/async/event/Event.hpp"
+#include "carpc/runtime/comm/async/Timeline.hpp"
 #include "carpc/runtime/application/Context.hpp"
 #include "carpc/runtime/application/Process.hpp"
 #include "SendReceive.hpp"
@@ -123,6 +124,7 @@ bool SendReceive::send( const ipc::Packet& packet, const application::Context& t
 
 bool SendReceive::send( const async::IEvent::tSptr p_event, const application::Context& to_context )
 {
+   async::timeline::record( async::timeline::eStage::IPC_SEND, *p_event );
    ipc::Packet packet( ipc::eCommand::IpcEvent, *p_event, to_context );
    return send( packet, to_context );
 }
@@ -491,6 +493,7 @@ bool SendReceive::Connections::process_package( ipc::Package& package, os::Socke
             SYS_ERR( "lost received event" );
             return false;
          }
+         async::timeline::record( async::timeline::eStage::IPC_RECEIVE, *p_event );
 
          application::Context to_context = application::Context::internal_broadcast;
          if( false == package.data( to_context ) )
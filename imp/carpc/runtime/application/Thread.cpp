@@ -2,6 +2,7 @@
 #include "SystemEventConsumer.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "Srv"
 
 
@@ -11,16 +12,26 @@ using namespace carpc::application;
 
 
 Thread::Thread( const Configuration& config )
-   : ThreadBase( config.m_name, config.m_wd_timeout )
+   : ThreadBase(
+         config.m_name,
+         config.m_wd_timeout,
+         {
+            config.m_queue_type, config.m_queue_capacity, config.m_overflow_policy,
+            config.m_wait_strategy, config.m_spin_count
+         },
+         config.m_batch_size
+      )
    , m_components( )
    , m_component_creators( config.m_component_creators )
 {
-   SYS_VRB( "'%s': created", m_name.c_str( ) );
+   if( 0 < config.m_workers )
+      mp_workers = std::make_unique< Workers >( *this, config.m_workers );
+   RT_VRB( "'%s': created", m_name.c_str( ) );
 }
 
 Thread::~Thread( )
 {
-   SYS_VRB( "'%s': destroyed", m_name.c_str( ) );
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
 }
 
 void Thread::thread_loop( )
@@ -34,16 +45,35 @@ void Thread::thread_loop( )
    for( auto creator : m_component_creators )
       m_components.emplace_back( creator( ) );
 
+   async::IAsyncQueue::tBatch batch;
+   batch.reserve( m_batch_size );
    while( m_started.load( ) )
    {
-      async::IAsync::tSptr p_async = get_async( );
-      SYS_VRB( "'%s': processing async object (%s)",
-            m_name.c_str( ),
-            p_async->signature( )->dbg_name( ).c_str( )
-         );
-      notify_consumers( p_async );
+      get_async( batch );
+      for( const auto& p_async : batch )
+      {
+         // Thread could be stopped by one of async objects from the batch
+         if( false == m_started.load( ) )
+            break;
+
+         RT_VRB( "'%s': processing async object (%s)",
+               m_name.c_str( ),
+               p_async->signature( )->dbg_name( ).c_str( )
+            );
+         // Concurrent async objects are processed by workers in case if there are any of them
+         if( mp_workers && p_async->is_concurrent( ) && mp_workers->push( p_async ) )
+            continue;
+
+         notify_consumers( p_async );
+      }
+      batch.clear( );
    }
 
+   // Workers are stopped before components are destroyed, because concurrent async objects
+   // could refer to them.
+   if( mp_workers )
+      mp_workers->stop( );
+
    // Destroying components
    m_components.clear( );
 
@@ -53,6 +83,13 @@ void Thread::thread_loop( )
 bool Thread::start( )
 {
    SYS_INF( "'%s': starting", m_name.c_str( ) );
+   if( mp_workers && false == mp_workers->start( ) )
+   {
+      SYS_ERR( "'%s': workers can't be started", m_name.c_str( ) );
+      mp_workers->stop( );
+      return false;
+   }
+
    bool result = m_thread.run( m_name.c_str( ) );
    if( false == result )
    {
@@ -10,12 +10,13 @@ using namespace carpc::application;
 
 
 
-ThreadBase::ThreadBase( const std::string& name, const std::size_t wd_timeout )
+ThreadBase::ThreadBase( const std::string& name, const std::size_t wd_timeout, const async::IAsyncQueue::Configuration& queue_configuration, const std::size_t batch_size )
    : IThread( )
    , m_thread( std::bind( &ThreadBase::thread_loop_base, this ) )
    , m_name( name )
    , m_wd_timeout( wd_timeout )
-   , m_async_processor( name )
+   , m_batch_size( 0 == batch_size ? 1 : batch_size )
+   , m_async_processor( name, queue_configuration )
 {
    SYS_VRB( "'%s': created", m_name.c_str( ) );
 }
@@ -27,10 +28,15 @@ ThreadBase::~ThreadBase( )
 
 void ThreadBase::thread_loop_base( )
 {
+   IThread::current( this );
+   // Components created by 'thread_loop' could send to this thread before the first extraction,
+   // so full bounded queue must already know that this thread is its consumer and can't be blocked.
+   m_async_processor.bind_consumer( );
    thread_loop( );
+   IThread::current( nullptr );
 }
 
-bool ThreadBase::insert_async( const async::IAsync::tSptr p_async )
+bool ThreadBase::insert_async( async::IAsync::tSptr p_async )
 {
    if( false == m_started.load( ) )
    {
@@ -38,7 +44,13 @@ bool ThreadBase::insert_async( const async::IAsync::tSptr p_async )
       return false;
    }
 
-   return m_async_processor.insert_async( p_async );
+   // Async object crosses to other os thread in case if it is inserted by other application thread
+   // or by worker or in case if it will be processed by worker, so since now its references
+   // are counted atomically.
+   if( this != IThread::current( ) || true == IThread::is_worker( ) || true == p_async->is_concurrent( ) )
+      p_async->share( );
+
+   return m_async_processor.insert_async( std::move( p_async ) );
 }
 
 carpc::async::IAsync::tSptr ThreadBase::get_async( )
@@ -46,7 +58,12 @@ carpc::async::IAsync::tSptr ThreadBase::get_async( )
    return m_async_processor.get_async( );
 }
 
-void ThreadBase::notify_consumers( const async::IAsync::tSptr p_async )
+std::size_t ThreadBase::get_async( async::IAsyncQueue::tBatch& batch )
+{
+   return m_async_processor.get_async( batch, m_batch_size );
+}
+
+void ThreadBase::notify_consumers( const async::IAsync::tSptr& p_async )
 {
    m_async_processor.notify_consumers( p_async );
 }
@@ -66,7 +83,7 @@ void ThreadBase::clear_all_notifications( const async::IAsync::ISignature::tSptr
    m_async_processor.clear_all_notifications( p_signature, p_consumer );
 }
 
-bool ThreadBase::is_subscribed( const async::IAsync::tSptr p_async )
+bool ThreadBase::is_subscribed( const async::IAsync::tSptr& p_async )
 {
    return m_async_processor.is_subscribed( p_async );
 }
@@ -79,7 +96,12 @@ void ThreadBase::dump( ) const
    SYS_DUMP_END( );
 }
 
-bool ThreadBase::send( const async::IAsync::tSptr, const application::Context& )
+carpc::async::metrics::Snapshot ThreadBase::metrics( ) const
+{
+   return m_async_processor.metrics( );
+}
+
+bool ThreadBase::send( const async::IAsync::tSptr&, const application::Context& )
 {
    SYS_WRN( "not supported for not IPC thread" );
    return false;
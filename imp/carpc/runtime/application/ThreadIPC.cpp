@@ -5,6 +5,7 @@
 #include "ServiceEventConsumer.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "SrvIPC"
 
 
@@ -14,7 +15,7 @@ using namespace carpc::application;
 
 
 ThreadIPC::ThreadIPC( )
-   : ThreadBase( "IPC", 10 )
+   : ThreadBase( "IPC", 10, { }, 16 )
 {
    SYS_VRB( "'%s': created", m_name.c_str( ) );
    mp_send_receive = new SendReceive;
@@ -47,14 +48,24 @@ void ThreadIPC::thread_loop( )
    SystemEventConsumer system_event_consumer( *this );
    ServiceEventConsumer service_event_consumer( mp_send_receive );
 
+   async::IAsyncQueue::tBatch batch;
+   batch.reserve( m_batch_size );
    while( m_started.load( ) )
    {
-      async::IAsync::tSptr p_async = get_async( );
-      SYS_VRB( "'%s': processing async object (%s)",
-            m_name.c_str( ),
-            p_async->signature( )->dbg_name( ).c_str( )
-         );
-      notify_consumers( p_async );
+      get_async( batch );
+      for( const auto& p_async : batch )
+      {
+         // Thread could be stopped by one of async objects from the batch
+         if( false == m_started.load( ) )
+            break;
+
+         RT_VRB( "'%s': processing async object (%s)",
+               m_name.c_str( ),
+               p_async->signature( )->dbg_name( ).c_str( )
+            );
+         notify_consumers( p_async );
+      }
+      batch.clear( );
    }
 
    SYS_INF( "'%s': exit", m_name.c_str( ) );
@@ -97,7 +108,7 @@ void ThreadIPC::shutdown( const std::string& message )
    stop( );
 }
 
-bool ThreadIPC::send( const async::IAsync::tSptr p_event, const application::Context& to_context )
+bool ThreadIPC::send( const async::IAsync::tSptr& p_event, const application::Context& to_context )
 {
-   return mp_send_receive->send( std::static_pointer_cast< async::IEvent >( p_event ), to_context );
+   return mp_send_receive->send( async::static_pointer_cast< async::IEvent >( p_event ), to_context );
 }
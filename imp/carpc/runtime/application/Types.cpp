@@ -10,6 +10,10 @@ namespace carpc::application {
 
       const ID& current_id( )
       {
+         if( Process::tRptr p_process = Process::raw_instance( ) )
+            return p_process->id( );
+
+         // Process is created on demand in case if id is requested before process has been created.
          return Process::instance( )->id( );
       }
 
@@ -19,7 +23,7 @@ namespace carpc::application {
 
       const ID& current_id( )
       {
-         IThread::tSptr thread = Process::instance( )->current_thread( );
+         IThread::tRptr thread = IThread::current( );
          if( nullptr != thread )
             return thread->id( );
 
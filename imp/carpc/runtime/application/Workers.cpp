@@ -0,0 +1,172 @@
+#include "carpc/runtime/application/Workers.hpp"
+#include "carpc/runtime/comm/async/Timeline.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
+#define CLASS_ABBR "Workers"
+
+
+
+using namespace carpc::application;
+
+
+
+Workers::Worker::Worker( const std::function< void( ) >& loop )
+   : thread( loop )
+{
+}
+
+
+
+Workers::Workers( IThread& owner, const std::size_t count )
+   : m_owner( owner )
+{
+   m_workers.reserve( count );
+   for( std::size_t index = 0; index < count; ++index )
+      m_workers.emplace_back( std::make_unique< Worker >( std::bind( &Workers::worker_loop, this, index ) ) );
+
+   RT_VRB( "'%s': created %zu worker(s)", m_owner.name( ).c_str( ), count );
+}
+
+Workers::~Workers( )
+{
+   stop( );
+   RT_VRB( "'%s': destroyed", m_owner.name( ).c_str( ) );
+}
+
+bool Workers::start( )
+{
+   m_started.store( true );
+   for( std::size_t index = 0; index < m_workers.size( ); ++index )
+   {
+      const std::string name = format_string( m_owner.name( ).c_str( ), "_", index );
+      if( false == m_workers[ index ]->thread.run( name.c_str( ) ) )
+      {
+         SYS_ERR( "'%s': worker %zu can't be started", m_owner.name( ).c_str( ), index );
+         return false;
+      }
+   }
+
+   return true;
+}
+
+void Workers::stop( )
+{
+   if( false == m_started.exchange( false ) )
+      return;
+
+   {
+      std::lock_guard< std::mutex > lock( m_idle_mutex );
+   }
+   m_idle_cond_var.notify_all( );
+
+   // Workers exit only after all deques are drained, because senders of queued async objects
+   // could wait for their processing (blocking 'send', 'when_all').
+   for( auto& p_worker : m_workers )
+      p_worker->thread.join( );
+
+   // Async objects what have been pushed by other thread concurrently with stopping.
+   for( std::size_t index = 0; index < m_workers.size( ); ++index )
+   {
+      while( async::IAsync::tSptr p_async = pop( index ) )
+      {
+         SYS_WRN( "'%s': processing async object (%s) after workers are stopped",
+               m_owner.name( ).c_str( ),
+               p_async->signature( )->dbg_name( ).c_str( )
+            );
+         p_async->process( );
+      }
+   }
+}
+
+bool Workers::push( const async::IAsync::tSptr& p_async )
+{
+   if( false == m_started.load( ) || true == m_workers.empty( ) )
+      return false;
+
+   // Counter is incremented before pushing, so it is never decremented below zero by 'pop'.
+   // Increment is done under idle mutex to avoid lost wake up of worker what is going to sleep.
+   {
+      std::lock_guard< std::mutex > lock( m_idle_mutex );
+      m_pending.fetch_add( 1 );
+   }
+
+   const std::size_t index = m_next.fetch_add( 1, std::memory_order_relaxed ) % m_workers.size( );
+   {
+      Worker& worker = *m_workers[ index ];
+      std::lock_guard< std::mutex > lock( worker.mutex );
+      worker.deque.push_back( p_async );
+   }
+   m_idle_cond_var.notify_one( );
+   return true;
+}
+
+carpc::async::IAsync::tSptr Workers::pop( const std::size_t index )
+{
+   const std::size_t count = m_workers.size( );
+   for( std::size_t offset = 0; offset < count; ++offset )
+   {
+      Worker& worker = *m_workers[ ( index + offset ) % count ];
+      std::lock_guard< std::mutex > lock( worker.mutex );
+      if( true == worker.deque.empty( ) )
+         continue;
+
+      async::IAsync::tSptr p_async = nullptr;
+      if( 0 == offset )
+      {
+         p_async = std::move( worker.deque.front( ) );
+         worker.deque.pop_front( );
+      }
+      else
+      {
+         // Stealing from the opposite end to reduce contention with the owner of the deque.
+         p_async = std::move( worker.deque.back( ) );
+         worker.deque.pop_back( );
+      }
+      m_pending.fetch_sub( 1 );
+      return p_async;
+   }
+
+   return nullptr;
+}
+
+carpc::async::IAsync::tSptr Workers::wait( const std::size_t index )
+{
+   while( true )
+   {
+      if( async::IAsync::tSptr p_async = pop( index ) )
+         return p_async;
+
+      // All deques are empty.
+      if( false == m_started.load( ) )
+         return nullptr;
+
+      std::unique_lock< std::mutex > lock( m_idle_mutex );
+      m_idle_cond_var.wait( lock, [ this ]( ) { return 0 < m_pending.load( ) || false == m_started.load( ); } );
+   }
+
+   return nullptr;
+}
+
+void Workers::worker_loop( const std::size_t index )
+{
+   SYS_INF( "'%s': worker %zu enter", m_owner.name( ).c_str( ), index );
+   IThread::current( &m_owner );
+   IThread::is_worker( true );
+
+   while( async::IAsync::tSptr p_async = wait( index ) )
+   {
+      RT_VRB( "'%s': worker %zu processing async object (%s)",
+            m_owner.name( ).c_str( ),
+            index,
+            p_async->signature( )->dbg_name( ).c_str( )
+         );
+      async::timeline::record( async::timeline::eStage::PROCESS_BEGIN, *p_async );
+      p_async->process( );
+      async::timeline::record( async::timeline::eStage::PROCESS_END, *p_async );
+   }
+
+   IThread::is_worker( false );
+   IThread::current( nullptr );
+   SYS_INF( "'%s': worker %zu exit", m_owner.name( ).c_str( ), index );
+}
@@ -1,7 +1,10 @@
+#include <algorithm>
+
 #include "carpc/runtime/comm/async/event/Event.hpp"
 #include "carpc/runtime/comm/async/AsyncConsumerMap.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "EvConsMap"
 
 
@@ -12,18 +15,163 @@ using namespace carpc::async;
 
 AsyncConsumerMap::AsyncConsumerMap( const std::string& name )
    : m_name( name )
+   , m_subscriber( SubscriptionIndex::instance( ).attach( ) )
 {
-   SYS_VRB( "'%s': created", m_name.c_str( ) );
+   RT_VRB( "'%s': created", m_name.c_str( ) );
 }
 
 AsyncConsumerMap::~AsyncConsumerMap( )
 {
-   SYS_VRB( "'%s': destroyed", m_name.c_str( ) );
+   SubscriptionIndex::instance( ).detach( m_subscriber );
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
+}
+
+bool AsyncConsumerMap::is_equivalent( const IAsync::ISignature& signature_1, const IAsync::ISignature& signature_2 )
+{
+   // Interned signatures are mostly the same objects.
+   if( &signature_1 == &signature_2 )
+      return true;
+   return !( signature_1 < signature_2 ) && !( signature_2 < signature_1 );
+}
+
+bool AsyncConsumerMap::add_consumer( tConsumers& consumers, IAsync::IConsumer* p_consumer )
+{
+   if( consumers.end( ) != std::find( consumers.begin( ), consumers.end( ), p_consumer ) )
+      return false;
+
+   consumers.push_back( p_consumer );
+   return true;
+}
+
+bool AsyncConsumerMap::remove_consumer( tConsumers& consumers, IAsync::IConsumer* p_consumer )
+{
+   auto iterator = std::find( consumers.begin( ), consumers.end( ), p_consumer );
+   if( consumers.end( ) == iterator )
+      return false;
+
+   consumers.erase( iterator );
+   return true;
+}
+
+std::size_t AsyncConsumerMap::find( const IAsync::ISignature& signature ) const
+{
+   if( true == m_slots.empty( ) )
+      return s_not_found;
+
+   const std::size_t hash = signature.hash( );
+   const std::size_t mask = m_slots.size( ) - 1;
+   for( std::size_t index = hash & mask; nullptr != m_slots[ index ].p_signature; index = ( index + 1 ) & mask )
+   {
+      const Slot& slot = m_slots[ index ];
+      if( hash == slot.hash && is_equivalent( *slot.p_signature, signature ) )
+         return index;
+   }
+
+   return s_not_found;
+}
+
+std::size_t AsyncConsumerMap::emplace( const IAsync::ISignature::tSptr p_signature )
+{
+   const std::size_t found = find( *p_signature );
+   if( s_not_found != found )
+      return found;
+
+   // Load factor is kept not higher then 3/4 to keep probing sequences short.
+   if( ( m_count + 1 ) * 4 > m_slots.size( ) * 3 )
+      rehash( std::max( s_initial_slots, m_slots.size( ) * 2 ) );
+
+   const std::size_t hash = p_signature->hash( );
+   const std::size_t mask = m_slots.size( ) - 1;
+   std::size_t index = hash & mask;
+   while( nullptr != m_slots[ index ].p_signature )
+      index = ( index + 1 ) & mask;
+
+   m_slots[ index ].hash = hash;
+   m_slots[ index ].p_signature = p_signature;
+   ++m_count;
+   SubscriptionIndex::instance( ).add( m_subscriber, hash );
+   return index;
+}
+
+void AsyncConsumerMap::erase( const std::size_t index )
+{
+   // Backward shift deletion: each next slot of the probing sequence is moved to the hole
+   // in case if the hole is between its home slot and its current slot.
+   // This keeps all probing sequences unbroken without tombstones.
+   SubscriptionIndex::instance( ).remove( m_subscriber, m_slots[ index ].hash );
+
+   const std::size_t mask = m_slots.size( ) - 1;
+   std::size_t hole = index;
+   for( std::size_t next = ( hole + 1 ) & mask; nullptr != m_slots[ next ].p_signature; next = ( next + 1 ) & mask )
+   {
+      const std::size_t home = m_slots[ next ].hash & mask;
+      if( ( ( next - home ) & mask ) >= ( ( next - hole ) & mask ) )
+      {
+         m_slots[ hole ] = std::move( m_slots[ next ] );
+         hole = next;
+      }
+   }
+
+   m_slots[ hole ] = Slot{ };
+   --m_count;
+}
+
+void AsyncConsumerMap::rehash( const std::size_t size )
+{
+   tSlots slots( size );
+   const std::size_t mask = size - 1;
+   for( Slot& slot : m_slots )
+   {
+      if( nullptr == slot.p_signature )
+         continue;
+
+      std::size_t index = slot.hash & mask;
+      while( nullptr != slots[ index ].p_signature )
+         index = ( index + 1 ) & mask;
+      slots[ index ] = std::move( slot );
+   }
+
+   m_slots.swap( slots );
+}
+
+void AsyncConsumerMap::subscribe( const std::size_t index, IAsync::IConsumer* p_consumer )
+{
+   Slot& slot = m_slots[ index ];
+   if( false == add_consumer( slot.consumers, p_consumer ) )
+      return;
+   ++m_subscriptions;
+
+   m_consumer_index[ ConsumerKey{ p_consumer, slot.p_signature->type_id( ) } ].push_back( slot.p_signature );
+}
+
+void AsyncConsumerMap::unsubscribe( const std::size_t index, IAsync::IConsumer* p_consumer )
+{
+   Slot& slot = m_slots[ index ];
+   if( false == remove_consumer( slot.consumers, p_consumer ) )
+      return;
+   --m_subscriptions;
+
+   auto iterator = m_consumer_index.find( ConsumerKey{ p_consumer, slot.p_signature->type_id( ) } );
+   if( m_consumer_index.end( ) != iterator )
+   {
+      tSignatures& signatures = iterator->second;
+      auto iterator_signature = std::find( signatures.begin( ), signatures.end( ), slot.p_signature );
+      if( signatures.end( ) != iterator_signature )
+      {
+         *iterator_signature = std::move( signatures.back( ) );
+         signatures.pop_back( );
+      }
+      if( true == signatures.empty( ) )
+         m_consumer_index.erase( iterator );
+   }
+
+   if( true == slot.consumers.empty( ) )
+      erase( index );
 }
 
 void AsyncConsumerMap::set_notification( const IAsync::ISignature::tSptr p_signature, IAsync::IConsumer* p_consumer )
 {
-   SYS_INF( "'%s': async object (%s) / consumer (%p)",
+   RT_DBG( "'%s': async object (%s) / consumer (%p)",
          m_name.c_str( ),
          p_signature->dbg_name( ).c_str( ),
          p_consumer
@@ -33,28 +181,18 @@ void AsyncConsumerMap::set_notification( const IAsync::ISignature::tSptr p_signa
 
    if( is_processing( p_signature ) )
    {
-      m_consumers_to_add.insert( p_consumer );
-      m_consumers_to_remove.erase( p_consumer );
+      add_consumer( m_consumers_to_add, p_consumer );
+      remove_consumer( m_consumers_to_remove, p_consumer );
    }
    else
    {
-      const auto& iterator_map = m_map.find( p_signature );
-      if( m_map.end( ) == iterator_map )
-      {
-         m_map.emplace(
-            std::pair< const IAsync::ISignature::tSptr, tConsumersSet >( p_signature, { p_consumer } )
-         );
-      }
-      else
-      {
-         iterator_map->second.emplace( p_consumer );
-      }
+      subscribe( emplace( p_signature ), p_consumer );
    }
 }
 
 void AsyncConsumerMap::clear_notification( const IAsync::ISignature::tSptr p_signature, IAsync::IConsumer* p_consumer )
 {
-   SYS_INF( "'%s': async object (%s) / consumer (%p)",
+   RT_DBG( "'%s': async object (%s) / consumer (%p)",
          m_name.c_str( ),
          p_signature->dbg_name( ).c_str( ),
          p_consumer
@@ -64,21 +202,16 @@ void AsyncConsumerMap::clear_notification( const IAsync::ISignature::tSptr p_sig
 
    if( is_processing( p_signature ) )
    {
-      m_consumers_to_add.erase( p_consumer );
-      m_consumers_to_remove.insert( p_consumer );
+      remove_consumer( m_consumers_to_add, p_consumer );
+      add_consumer( m_consumers_to_remove, p_consumer );
    }
    else
    {
-      const auto& iterator_map = m_map.find( p_signature );
-      if( m_map.end( ) == iterator_map )
+      const std::size_t index = find( *p_signature );
+      if( s_not_found == index )
          return;
 
-      auto& consumers_set = iterator_map->second;
-      consumers_set.erase( p_consumer );
-      if( true == consumers_set.empty( ) )
-      {
-         m_map.erase( iterator_map );
-      }
+      unsubscribe( index, p_consumer );
    }
 
 }
@@ -87,91 +220,80 @@ void AsyncConsumerMap::clear_all_notifications( const IAsync::ISignature::tSptr
 {
    if( nullptr == p_consumer ) return;
 
-   auto iterator_map = m_map.begin( );
-   while( m_map.end( ) != iterator_map )
+   auto iterator = m_consumer_index.find( ConsumerKey{ p_consumer, p_signature->type_id( ) } );
+   if( m_consumer_index.end( ) == iterator )
+      return;
+
+   // Copy is used because 'unsubscribe' modifies index record of the consumer.
+   const tSignatures signatures = iterator->second;
+   for( const auto& p_subscribed_signature : signatures )
    {
-      if( p_signature->type_id( ) != iterator_map->first->type_id( ) )
+      // Consumers of currently processed signature must not be modified till the end of processing.
+      if( is_processing( p_subscribed_signature ) )
       {
-         ++iterator_map;
+         remove_consumer( m_consumers_to_add, p_consumer );
+         add_consumer( m_consumers_to_remove, p_consumer );
          continue;
       }
 
-      tConsumersSet& consumers_set = iterator_map->second;
-      if( 0 == consumers_set.erase( p_consumer ) )
-      {
-         // There was no removed consumer for current 'signature' =>
-         // we need to increment 'iterator_map' to check next 'signature'
-         ++iterator_map;
-      }
-      else
-      {
-         if( true == consumers_set.empty( ) )
-         {
-            // For current 'signature' consumer has been just removed and there are no
-            // other consumers for this 'signature' => we can remove corresponding record
-            // for this 'signature' from the map to save the space and indicate that
-            // THERE ARE NO SUBSCRIBERS for this 'signature'.
-            // In this case we call 'erase' method what removes corresponding record what
-            // is pointed by 'iterator_map' and set this iterator to the next one element.
-            // This means we do not need to increment 'iterator_map'.
-            iterator_map = m_map.erase( iterator_map );
-         }
-         else
-         {
-            // There was removed consumer for current 'signature' =>
-            // we need to increment 'iterator_map' to check next 'signature'
-            ++iterator_map;
-         }
-      }
+      const std::size_t index = find( *p_subscribed_signature );
+      if( s_not_found != index )
+         unsubscribe( index, p_consumer );
    }
 }
 
-bool AsyncConsumerMap::is_subscribed( const IAsync::ISignature::tSptr p_signature )
+bool AsyncConsumerMap::is_subscribed( const IAsync::ISignature::tSptr& p_signature ) const
 {
    // If any record is presend in DB for current signature this means that there is at least
    // one consumer must be present for this async object.
    // This is the reason why any record for any signature must be deleted in case of
    // there is no any consumers for this signature any more.
-   return m_map.end( ) != m_map.find( p_signature );
+   // Records are published to subscription index, so the map itself is not accessed here
+   // and this function could be called from the thread what does not own the map.
+   return SubscriptionIndex::instance( ).is_subscribed( m_subscriber, p_signature->hash( ) );
 }
 
-bool AsyncConsumerMap::process( const IAsync::tSptr p_async, std::atomic< time_t >& timestamp )
+bool AsyncConsumerMap::process( const IAsync::tSptr& p_async, std::atomic< time_t >& timestamp )
 {
-   if( mp_processing_async )
+   if( nullptr != mp_processing_signature )
    {
       SYS_WRN( "'%s': can't process async object '%s' because of processing another one '%s'",
             m_name.c_str( ),
             p_async->signature( )->dbg_name( ).c_str( ),
-            mp_processing_async->signature( )->dbg_name( ).c_str( )
+            mp_processing_signature->dbg_name( ).c_str( )
          );
       return false;
    }
 
 
-   auto iterator_map = m_map.find( p_async->signature( ) );
-   if( m_map.end( ) == iterator_map )
+   const IAsync::ISignature& signature = *( p_async->signature( ) );
+   std::size_t index = find( signature );
+   if( s_not_found == index )
    {
       SYS_WRN( "'%s': consumers are not found for async object (%s)",
-            m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( )
+            m_name.c_str( ), signature.dbg_name( ).c_str( )
          );
       return false;
    }
 
-   // Here we work with the original consumers collection by referance
-   // to avoid copying process.
-   // But this could lead to some specific case what is described below.
-   // The method for resolving this issue is also described below.
-   tConsumersSet& consumers = iterator_map->second;
+   // Here we work with the original consumers collection to avoid copying process.
+   // During processing the slot itself could be moved inside the table by subscription or
+   // unsubscription for other signatures, but consumers collection of currently processed
+   // signature is never modified (see below) and moving of vector keeps its buffer,
+   // so pointer to the buffer stays valid.
+   const tConsumers& consumers = m_slots[ index ].consumers;
+   IAsync::IConsumer* const* p_consumers = consumers.data( );
+   const std::size_t count = consumers.size( );
 
-   mp_processing_async = p_async;
+   mp_processing_signature = &signature;
 
-   for( IAsync::IConsumer* p_consumer : consumers )
+   for( std::size_t position = 0; position < count; ++position )
    {
       timestamp.store( time( nullptr ) );
-      SYS_VRB( "'%s': start processing async object at %ld (%s)",
+      RT_VRB( "'%s': start processing async object at %ld (%s)",
             m_name.c_str( ),
             timestamp.load( ),
-            p_async->signature( )->dbg_name( ).c_str( )
+            signature.dbg_name( ).c_str( )
          );
 
       // Here will be called corresponding 'process_event' the corresponding consumer.
@@ -180,28 +302,37 @@ bool AsyncConsumerMap::process( const IAsync::tSptr p_async, std::atomic< time_t
       //    - 'clear_notification'
       //    - 'clear_all_notifications'
       // In this case each of these methods will be called for current context and
-      // there will no be a reise condition during accessing 'm_map' resource.
+      // there will no be a reise condition during accessing 'm_slots' resource.
       // There could be only the situation when new consumers will be added or
       // removed existing for the 'signature' what is currently processed.
       // This will lead to breakdown current iteration loop.
       // To avoid this issue was introduced specific logic for subscription and
-      // unsubscription for the same 'signature' what is currently under processing. 
-      p_async->process( p_consumer );
+      // unsubscription for the same 'signature' what is currently under processing.
+      p_async->process( p_consumers[ position ] );
 
-      SYS_VRB( "'%s': finished processing async object started at %ld (%s)",
+      RT_VRB( "'%s': finished processing async object started at %ld (%s)",
             m_name.c_str( ),
             timestamp.load( ),
-            p_async->signature( )->dbg_name( ).c_str( )
+            signature.dbg_name( ).c_str( )
          );
    }
    timestamp.store( 0 );
 
-   consumers.merge( m_consumers_to_add );
-   for( const auto& consumer_to_remove : m_consumers_to_remove )
-      consumers.erase( consumer_to_remove );
+   // Slot could be moved during processing => it should be found again.
+   index = find( signature );
+   for( IAsync::IConsumer* p_consumer : m_consumers_to_add )
+      subscribe( index, p_consumer );
+   // Record is erased by the last unsubscription and other records could be shifted to its slot.
+   for( IAsync::IConsumer* p_consumer : m_consumers_to_remove )
+   {
+      index = find( signature );
+      if( s_not_found == index )
+         break;
+      unsubscribe( index, p_consumer );
+   }
    m_consumers_to_add.clear( );
    m_consumers_to_remove.clear( );
-   mp_processing_async.reset( );
+   mp_processing_signature = nullptr;
 
    return true;
 }
@@ -209,28 +340,26 @@ bool AsyncConsumerMap::process( const IAsync::tSptr p_async, std::atomic< time_t
 void AsyncConsumerMap::dump( ) const
 {
    SYS_DUMP_START( );
-   SYS_INF( "%s:", m_name.c_str( ) );
-   for( const auto& pair : m_map )
+   SYS_INF( "%s: %zu signature(s) / %zu slot(s)", m_name.c_str( ), m_count.load( ), m_slots.size( ) );
+   for( const Slot& slot : m_slots )
    {
-      printf( "%s => ", pair.first->dbg_name( ).c_str( ) );
-      for( const auto item : pair.second )
+      if( nullptr == slot.p_signature )
+         continue;
+
+      printf( "%s => ", slot.p_signature->dbg_name( ).c_str( ) );
+      for( const auto item : slot.consumers )
          printf( "%p, ", item );
       printf( "\n" );
    }
    SYS_DUMP_END( );
 }
 
-bool AsyncConsumerMap::is_processing( const IAsync::ISignature::tSptr p_signature ) const
+bool AsyncConsumerMap::is_processing( const IAsync::ISignature::tSptr& p_signature ) const
 {
    if( not p_signature )
       return false;
-   if( not mp_processing_async )
+   if( nullptr == mp_processing_signature )
       return false;
 
-   if( *p_signature < *( mp_processing_async->signature( ) ) )
-      return false;
-   if( *( mp_processing_async->signature( ) ) < *p_signature )
-      return false;
-
-   return true;
+   return is_equivalent( *p_signature, *mp_processing_signature );
 }
@@ -0,0 +1,189 @@
+#include <algorithm>
+
+#include "carpc/runtime/comm/async/event/Event.hpp"
+#include "carpc/runtime/comm/async/AsyncDeadlineQueue.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
+#define CLASS_ABBR "AsyncDeadlineQueue"
+
+
+
+using namespace carpc::async;
+
+
+
+AsyncDeadlineQueue::AsyncDeadlineQueue( const std::string& name, const Configuration& configuration )
+   : IAsyncQueue( name, configuration )
+{
+   RT_VRB( "'%s': created", m_name.c_str( ) );
+}
+
+AsyncDeadlineQueue::~AsyncDeadlineQueue( )
+{
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
+}
+
+bool AsyncDeadlineQueue::make_space( const IAsync::tSptr& p_async )
+{
+   if( true == m_collection.empty( ) )
+      return false;
+
+   auto iterator = m_collection.end( );
+   switch( m_overflow_policy )
+   {
+      case eOverflowPolicy::DROP_OLDEST:
+      {
+         iterator = std::min_element( m_collection.begin( ), m_collection.end( ),
+               []( const Entry& lhs, const Entry& rhs ) { return lhs.sequence < rhs.sequence; }
+            );
+         break;
+      }
+      case eOverflowPolicy::DROP_LOWEST_PRIORITY:
+      {
+         iterator = std::min_element( m_collection.begin( ), m_collection.end( ), Later( ) );
+         if( iterator->deadline < p_async->deadline( ) )
+            return false;
+         break;
+      }
+      default:
+      {
+         return false;
+      }
+   }
+
+   on_dropped( iterator->p_async );
+   *iterator = std::move( m_collection.back( ) );
+   m_collection.pop_back( );
+   std::make_heap( m_collection.begin( ), m_collection.end( ), Later( ) );
+   m_size.fetch_sub( 1 );
+   return true;
+}
+
+bool AsyncDeadlineQueue::insert( IAsync::tSptr p_async )
+{
+   if( is_freezed( ) )
+   {
+      RT_VRB( "'%s': async object (%s) can't be inserted, because of collection is freezed",
+         m_name.c_str( ),
+         p_async->signature( )->dbg_name( ).c_str( )
+      );
+      return false;
+   }
+
+   RT_VRB( "'%s': inserting async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
+   const IAsync::tDeadline deadline = p_async->deadline( );
+
+   m_buffer_cond_var.lock( );
+   while( is_full( ) )
+   {
+      if( eOverflowPolicy::BLOCK == m_overflow_policy )
+      {
+         m_buffer_cond_var.unlock( );
+         if( false == wait_for_space( ) )
+         {
+            on_rejected( p_async );
+            return false;
+         }
+         m_buffer_cond_var.lock( );
+         continue;
+      }
+
+      if( false == make_space( p_async ) )
+      {
+         m_buffer_cond_var.unlock( );
+         on_rejected( p_async );
+         return false;
+      }
+   }
+   m_collection.push_back( { deadline, m_sequence++, std::move( p_async ) } );
+   std::push_heap( m_collection.begin( ), m_collection.end( ), Later( ) );
+   on_inserted( );
+   m_buffer_cond_var.notify( );
+   m_buffer_cond_var.unlock( );
+
+   return true;
+}
+
+IAsync::tSptr AsyncDeadlineQueue::extract( const IAsync::tDeadline& now )
+{
+   std::pop_heap( m_collection.begin( ), m_collection.end( ), Later( ) );
+   Entry entry = std::move( m_collection.back( ) );
+   m_collection.pop_back( );
+
+   if( IAsync::no_deadline != entry.deadline && now > entry.deadline )
+   {
+      m_missed.fetch_add( 1, std::memory_order_relaxed );
+      RT_VRB( "'%s': async object (%s) missed its deadline", m_name.c_str( ), entry.p_async->signature( )->dbg_name( ).c_str( ) );
+   }
+
+   return std::move( entry.p_async );
+}
+
+IAsync::tSptr AsyncDeadlineQueue::get( )
+{
+   bind_consumer( );
+   const bool waited = spin_for_data( );
+   m_buffer_cond_var.lock( );
+   while( true == m_collection.empty( ) )
+   {
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      m_buffer_cond_var.wait( );
+   }
+   IAsync::tSptr p_async = extract( std::chrono::steady_clock::now( ) );
+   RT_VRB( "'%s': received async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
+   m_buffer_cond_var.unlock( );
+   on_extracted( );
+   if( waited )
+      on_woken_up( );
+
+   return p_async;
+}
+
+std::size_t AsyncDeadlineQueue::get_batch( tBatch& batch, const std::size_t max_count )
+{
+   bind_consumer( );
+   const bool waited = spin_for_data( );
+   m_buffer_cond_var.lock( );
+   while( true == m_collection.empty( ) )
+   {
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      m_buffer_cond_var.wait( );
+   }
+
+   // Deadline misses are checked against the time of batch extraction.
+   const IAsync::tDeadline now = std::chrono::steady_clock::now( );
+   const std::size_t count = std::min( std::max( max_count, std::size_t{ 1 } ), m_collection.size( ) );
+   for( std::size_t index = 0; index < count; ++index )
+      batch.emplace_back( extract( now ) );
+   RT_VRB( "'%s': received %zu async object(s)", m_name.c_str( ), count );
+   m_buffer_cond_var.unlock( );
+   on_extracted( count );
+   if( waited )
+      on_woken_up( );
+
+   return count;
+}
+
+void AsyncDeadlineQueue::clear( )
+{
+   m_buffer_cond_var.lock( );
+   SYS_INF( "clearing collection..." );
+   const std::size_t count = m_collection.size( );
+   m_collection.clear( );
+   m_buffer_cond_var.unlock( );
+   on_extracted( count );
+}
+
+void AsyncDeadlineQueue::dump( ) const
+{
+   SYS_DUMP_START( );
+   SYS_INF( "%s:", m_name.c_str( ) );
+   dump_statistics( );
+   SYS_INF( "   missed deadlines: %zu", m_missed.load( ) );
+   for( const auto& entry : m_collection )
+   {
+      SYS_INF( "%s", entry.p_async->signature( )->dbg_name( ).c_str( ) );
+   }
+   SYS_DUMP_END( );
+}
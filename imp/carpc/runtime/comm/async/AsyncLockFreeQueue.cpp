@@ -0,0 +1,219 @@
+#include <new>
+#include <thread>
+
+#include "carpc/runtime/comm/async/event/Event.hpp"
+#include "carpc/runtime/comm/async/AsyncLockFreeQueue.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
+#define CLASS_ABBR "AsyncLockFreeQueue"
+
+
+
+using namespace carpc::async;
+
+
+
+AsyncLockFreeQueue::AsyncLockFreeQueue( const std::string& name, const Configuration& configuration )
+   : IAsyncQueue( name, configuration )
+   , mp_head( &m_stub )
+   , mp_tail( &m_stub )
+{
+   RT_VRB( "'%s': created", m_name.c_str( ) );
+
+   if( eOverflowPolicy::BLOCK != m_overflow_policy && eOverflowPolicy::REJECT != m_overflow_policy )
+   {
+      SYS_WRN( "'%s': %s is not supported => %s will be used",
+            m_name.c_str( ), c_str( m_overflow_policy ), c_str( eOverflowPolicy::REJECT )
+         );
+   }
+}
+
+AsyncLockFreeQueue::~AsyncLockFreeQueue( )
+{
+   clear( );
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
+}
+
+void AsyncLockFreeQueue::push( Node* p_node )
+{
+   p_node->p_next.store( nullptr, std::memory_order_relaxed );
+   Node* p_prev = mp_head.exchange( p_node, std::memory_order_acq_rel );
+   // Between 'exchange' and 'store' the chain is broken for consumer.
+   // Consumer detects this state in 'pop' and does not treat queue as empty.
+   p_prev->p_next.store( p_node, std::memory_order_release );
+}
+
+AsyncLockFreeQueue::Node* AsyncLockFreeQueue::pop( )
+{
+   Node* p_tail = mp_tail;
+   Node* p_next = p_tail->p_next.load( std::memory_order_acquire );
+
+   if( &m_stub == p_tail )
+   {
+      if( nullptr == p_next )
+         return nullptr;
+
+      mp_tail = p_next;
+      p_tail = p_next;
+      p_next = p_next->p_next.load( std::memory_order_acquire );
+   }
+
+   if( nullptr != p_next )
+   {
+      mp_tail = p_next;
+      return p_tail;
+   }
+
+   // Some producer has already exchanged head but has not linked its node yet.
+   if( p_tail != mp_head.load( std::memory_order_acquire ) )
+      return nullptr;
+
+   // Only one node is in the queue => stub node should be returned back to make possible
+   // extracting the last node.
+   push( &m_stub );
+
+   p_next = p_tail->p_next.load( std::memory_order_acquire );
+   if( nullptr != p_next )
+   {
+      mp_tail = p_next;
+      return p_tail;
+   }
+
+   return nullptr;
+}
+
+bool AsyncLockFreeQueue::insert( IAsync::tSptr p_async )
+{
+   if( m_freezed.load( ) )
+   {
+      RT_VRB( "'%s': async object (%s) can't be inserted, because of collection is freezed",
+         m_name.c_str( ),
+         p_async->signature( )->dbg_name( ).c_str( )
+      );
+      return false;
+   }
+
+   RT_VRB( "'%s': inserting async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
+   while( false == reserve( ) )
+   {
+      if( eOverflowPolicy::BLOCK != m_overflow_policy || false == wait_for_space( ) )
+      {
+         on_rejected( p_async );
+         return false;
+      }
+   }
+
+   Node* p_node = new( tNodePool::allocate( ) ) Node;
+   p_node->p_async = std::move( p_async );
+   push( p_node );
+
+   // Consumer is notified only in case if it is parked (or is going to be parked).
+   // 'm_size' increment and 'm_waiting' check are sequentially consistent with
+   // 'm_waiting' set and 'm_size' check in 'get' => wake up can't be lost.
+   if( m_waiting.load( ) )
+   {
+      m_buffer_cond_var.lock( );
+      m_buffer_cond_var.notify( );
+      m_buffer_cond_var.unlock( );
+   }
+
+   return true;
+}
+
+// Reserves place for one async object before it is linked to the queue.
+bool AsyncLockFreeQueue::reserve( )
+{
+   std::size_t size = m_size.load( );
+   while( 0 == m_capacity || size < m_capacity )
+   {
+      if( m_size.compare_exchange_weak( size, size + 1 ) )
+      {
+         if( 0 == size )
+            mark_data_time( );
+         update_high_watermark( size + 1 );
+         return true;
+      }
+   }
+
+   return false;
+}
+
+IAsync::tSptr AsyncLockFreeQueue::extract( )
+{
+   Node* p_node = pop( );
+   if( nullptr == p_node )
+      return nullptr;
+
+   IAsync::tSptr p_async = std::move( p_node->p_async );
+   p_node->~Node( );
+   tNodePool::deallocate( p_node );
+   on_extracted( );
+   return p_async;
+}
+
+void AsyncLockFreeQueue::wait( )
+{
+   // Queue is not empty but producer is in the middle of insertion => node will be linked
+   // in a moment, so there is no reason to park.
+   if( 0 != m_size.load( ) )
+   {
+      std::this_thread::yield( );
+      return;
+   }
+
+   m_buffer_cond_var.lock( );
+   m_waiting.store( true );
+   if( 0 == m_size.load( ) )
+   {
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      m_buffer_cond_var.wait( );
+   }
+   m_waiting.store( false );
+   m_buffer_cond_var.unlock( );
+}
+
+IAsync::tSptr AsyncLockFreeQueue::get( )
+{
+   bind_consumer( );
+   const bool waited = spin_for_data( );
+   IAsync::tSptr p_async = nullptr;
+   while( nullptr == ( p_async = extract( ) ) )
+      wait( );
+   if( waited )
+      on_woken_up( );
+
+   RT_VRB( "'%s': received async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
+   return p_async;
+}
+
+std::size_t AsyncLockFreeQueue::get_batch( tBatch& batch, const std::size_t max_count )
+{
+   batch.emplace_back( get( ) );
+
+   std::size_t count = 1;
+   for( ; count < max_count; ++count )
+   {
+      IAsync::tSptr p_async = extract( );
+      if( nullptr == p_async )
+         break;
+      batch.emplace_back( std::move( p_async ) );
+   }
+
+   RT_VRB( "'%s': received %zu async object(s)", m_name.c_str( ), count );
+   return count;
+}
+
+void AsyncLockFreeQueue::clear( )
+{
+   SYS_INF( "clearing collection..." );
+   while( nullptr != extract( ) );
+}
+
+void AsyncLockFreeQueue::dump( ) const
+{
+   SYS_DUMP_START( );
+   SYS_INF( "%s:", m_name.c_str( ) );
+   dump_statistics( );
+   SYS_DUMP_END( );
+}
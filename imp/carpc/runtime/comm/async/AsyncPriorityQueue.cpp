@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <iterator>
+
 #include "carpc/runtime/comm/async/event/Event.hpp"
 #include "carpc/runtime/comm/async/AsyncPriorityQueue.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "AsyncPriorityQueue"
 
 
@@ -10,26 +14,116 @@ using namespace carpc::async;
 
 
 
-AsyncPriorityQueue::AsyncPriorityQueue( const std::string& name, const tPriority& max_priority )
-   : m_name( name )
+AsyncPriorityQueue::AsyncPriorityQueue( const std::string& name, const tPriority& max_priority, const Configuration& configuration )
+   : IAsyncQueue( name, configuration )
 {
-   SYS_VRB( "'%s': created", m_name.c_str( ) );
-   SYS_VRB( "max priority: %u", max_priority.value( ) );
+   RT_VRB( "'%s': created", m_name.c_str( ) );
+   RT_VRB( "max priority: %u", max_priority.value( ) );
+
+   std::size_t number = static_cast< std::size_t >( max_priority.value( ) );
+   if( 0 == number )
+      number = 1;
+   if( s_bits * s_bits < number )
+   {
+      SYS_WRN( "'%s': max priority %zu is not supported => %zu will be used", m_name.c_str( ), number, s_bits * s_bits );
+      number = s_bits * s_bits;
+   }
 
-   for( tPriority index = tPriority::zero; index < max_priority; ++index )
-      m_collections.push_back( { } );
+   m_collections.resize( number );
+   m_levels.resize( ( number + s_bits - 1 ) / s_bits, 0 );
 }
 
 AsyncPriorityQueue::~AsyncPriorityQueue( )
 {
-   SYS_VRB( "'%s': destroyed", m_name.c_str( ) );
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
+}
+
+void AsyncPriorityQueue::mark( const std::size_t index )
+{
+   const std::size_t word = index / s_bits;
+   m_levels[ word ] |= std::uint64_t{ 1 } << ( index % s_bits );
+   m_summary |= std::uint64_t{ 1 } << word;
+}
+
+void AsyncPriorityQueue::unmark( const std::size_t index )
+{
+   const std::size_t word = index / s_bits;
+   m_levels[ word ] &= ~( std::uint64_t{ 1 } << ( index % s_bits ) );
+   if( 0 == m_levels[ word ] )
+      m_summary &= ~( std::uint64_t{ 1 } << word );
+}
+
+// Must be called only in case if 'm_summary' is not zero.
+std::size_t AsyncPriorityQueue::highest( ) const
+{
+   const std::size_t word = s_bits - 1 - __builtin_clzll( m_summary );
+   const std::size_t bit = s_bits - 1 - __builtin_clzll( m_levels[ word ] );
+   return word * s_bits + bit;
+}
+
+// Must be called only in case if 'm_summary' is not zero.
+std::size_t AsyncPriorityQueue::lowest( ) const
+{
+   const std::size_t word = __builtin_ctzll( m_summary );
+   const std::size_t bit = __builtin_ctzll( m_levels[ word ] );
+   return word * s_bits + bit;
 }
 
-bool AsyncPriorityQueue::insert( const IAsync::tSptr p_async )
+bool AsyncPriorityQueue::make_space( const std::size_t index )
+{
+   if( 0 == m_summary )
+      return false;
+
+   std::size_t index_to_drop = lowest( );
+   switch( m_overflow_policy )
+   {
+      case eOverflowPolicy::DROP_OLDEST:
+      {
+         if( false == m_collections[ index ].empty( ) )
+            index_to_drop = index;
+         break;
+      }
+      case eOverflowPolicy::DROP_LOWEST_PRIORITY:
+      {
+         if( index_to_drop > index )
+            return false;
+         break;
+      }
+      default:
+      {
+         return false;
+      }
+   }
+
+   auto& collection = m_collections[ index_to_drop ];
+   on_dropped( collection.front( ) );
+   remove_conflated( &collection.front( ) );
+   collection.pop_front( );
+   if( true == collection.empty( ) )
+      unmark( index_to_drop );
+   m_size.fetch_sub( 1 );
+   return true;
+}
+
+// Must be called under locked 'm_buffer_cond_var' and only in case if 'm_summary' is not zero.
+IAsync::tSptr AsyncPriorityQueue::extract( )
+{
+   const std::size_t index = highest( );
+   auto& collection = m_collections[ index ];
+   remove_conflated( &collection.front( ) );
+   IAsync::tSptr p_async = std::move( collection.front( ) );
+   collection.pop_front( );
+   if( true == collection.empty( ) )
+      unmark( index );
+
+   return p_async;
+}
+
+bool AsyncPriorityQueue::insert( IAsync::tSptr p_async )
 {
    if( is_freezed( ) )
    {
-      SYS_VRB( "'%s': async object (%s) with priority %u can't be inserted, because of collection is freezed",
+      RT_VRB( "'%s': async object (%s) with priority %u can't be inserted, because of collection is freezed",
          m_name.c_str( ),
          p_async->signature( )->dbg_name( ).c_str( ),
          p_async->priority( ).value( )
@@ -37,21 +131,51 @@ bool AsyncPriorityQueue::insert( const IAsync::tSptr p_async )
       return false;
    }
 
-   SYS_VRB( "'%s': inserting async object (%s) with priority %u",
+   RT_VRB( "'%s': inserting async object (%s) with priority %u",
          m_name.c_str( ),
          p_async->signature( )->dbg_name( ).c_str( ),
          p_async->priority( ).value( )
       );
 
-   m_buffer_cond_var.lock( );
-
    // If priority of current async object is higher then max supported priority it will be inserted
    // with highest priority.
-   auto index = p_async->priority( ).value( ) >= m_collections.size( ) ?
-      m_collections.size( ) - 1 :
-         p_async->priority( ).value( );
-   m_collections[ index ].push_back( p_async );
+   const std::size_t index = std::min(
+         static_cast< std::size_t >( p_async->priority( ).value( ) ),
+         m_collections.size( ) - 1
+      );
+
+   m_buffer_cond_var.lock( );
+   if( true == try_conflate( p_async ) )
+   {
+      m_buffer_cond_var.unlock( );
+      return true;
+   }
+
+   while( is_full( ) )
+   {
+      if( eOverflowPolicy::BLOCK == m_overflow_policy )
+      {
+         m_buffer_cond_var.unlock( );
+         if( false == wait_for_space( ) )
+         {
+            on_rejected( p_async );
+            return false;
+         }
+         m_buffer_cond_var.lock( );
+         continue;
+      }
 
+      if( false == make_space( index ) )
+      {
+         m_buffer_cond_var.unlock( );
+         on_rejected( p_async );
+         return false;
+      }
+   }
+   m_collections[ index ].push_back( std::move( p_async ) );
+   add_conflated( &m_collections[ index ].back( ) );
+   mark( index );
+   on_inserted( );
    m_buffer_cond_var.notify( );
    m_buffer_cond_var.unlock( );
 
@@ -60,74 +184,102 @@ bool AsyncPriorityQueue::insert( const IAsync::tSptr p_async )
 
 IAsync::tSptr AsyncPriorityQueue::get( )
 {
-   SYS_VRB( "'%s':", m_name.c_str( ) );
+   RT_VRB( "'%s':", m_name.c_str( ) );
+   bind_consumer( );
+   const bool waited = spin_for_data( );
    m_buffer_cond_var.lock( );
 
-   // Check if there is any event with any priority starting from max priority to min.
-   // Remember maximum priority where event has been found.
-   std::optional< tPriority > priority_to_process = std::nullopt;
-   for( tPriority index = tPriority( m_collections.size( ) - 1 ); index > tPriority::zero; --index )
-   {
-      if( false == m_collections[ index ].empty( ) )
-      {
-         priority_to_process = index;
-         break;
-      }
-   }
-
    // Waiting for event in case if any event have not been found for any priority.
-   // in this case 'priority_to_process == std::nullopt'
-   if( std::nullopt == priority_to_process )
+   while( 0 == m_summary )
    {
-      SYS_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
       m_buffer_cond_var.wait( );
    }
 
-   // In case priority is not defined for what event exists collection should be iterated again.
-   if( std::nullopt == priority_to_process )
-   {
-      for( tPriority index = tPriority( m_collections.size( ) - 1 ); index > tPriority::zero; --index )
-      {
-         if( false == m_collections[ index ].empty( ) )
-         {
-            priority_to_process = index;
-            break;
-         }
-      }
-   }
-
-   auto& collection = m_collections[ priority_to_process.value( ) ];
-   IAsync::tSptr p_async = collection.front( );
-   collection.pop_front( );
-   SYS_VRB( "'%s': received async object (%s) with priority: %u",
+   IAsync::tSptr p_async = extract( );
+   RT_VRB( "'%s': received async object (%s) with priority: %u",
          m_name.c_str( ),
          p_async->signature( )->dbg_name( ).c_str( ),
          p_async->priority( ).value( )
       );
    m_buffer_cond_var.unlock( );
+   on_extracted( );
+   if( waited )
+      on_woken_up( );
 
    return p_async;
 }
 
+std::size_t AsyncPriorityQueue::get_batch( tBatch& batch, const std::size_t max_count )
+{
+   RT_VRB( "'%s':", m_name.c_str( ) );
+   bind_consumer( );
+   const bool waited = spin_for_data( );
+   m_buffer_cond_var.lock( );
+
+   while( 0 == m_summary )
+   {
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      m_buffer_cond_var.wait( );
+   }
+
+   // Async objects are extracted starting from max priority to min till batch is full,
+   // so order of processing inside the batch is the same as for sequential 'get' calls.
+   const std::size_t limit = std::max( max_count, std::size_t{ 1 } );
+   std::size_t count = 0;
+   while( 0 != m_summary && count < limit )
+   {
+      const std::size_t index = highest( );
+      auto& collection = m_collections[ index ];
+      const std::size_t number = std::min( limit - count, collection.size( ) );
+      const auto end = collection.begin( ) + number;
+      for( auto iterator = collection.begin( ); iterator != end; ++iterator )
+         remove_conflated( &( *iterator ) );
+      std::move( collection.begin( ), end, std::back_inserter( batch ) );
+      collection.erase( collection.begin( ), end );
+      if( true == collection.empty( ) )
+         unmark( index );
+      count += number;
+   }
+   RT_VRB( "'%s': received %zu async object(s)", m_name.c_str( ), count );
+   m_buffer_cond_var.unlock( );
+   on_extracted( count );
+   if( waited )
+      on_woken_up( );
+
+   return count;
+}
+
 void AsyncPriorityQueue::clear( )
 {
    m_buffer_cond_var.lock( );
    SYS_INF( "clearing collection..." );
-   for( tPriority index = tPriority( m_collections.size( ) - 1 ); index > tPriority::zero; --index )
+   std::size_t count = 0;
+   for( auto& collection : m_collections )
    {
-      m_collections[ index ].clear( );
+      count += collection.size( );
+      collection.clear( );
    }
+   std::fill( m_levels.begin( ), m_levels.end( ), 0 );
+   m_summary = 0;
+   clear_conflated( );
    m_buffer_cond_var.unlock( );
+   on_extracted( count );
 }
 
 void AsyncPriorityQueue::dump( ) const
 {
    SYS_DUMP_START( );
    SYS_INF( "%s:", m_name.c_str( ) );
-   for( tPriority index = tPriority( m_collections.size( ) - 1 ); index > tPriority::zero; --index )
+   dump_statistics( );
+   for( std::size_t index = m_collections.size( ); index > 0; --index )
    {
-      SYS_INF( "   priority: %s", index.dbg_name( ).c_str( ) );
-      for( auto p_async : m_collections[ index ] )
+      const auto& collection = m_collections[ index - 1 ];
+      if( true == collection.empty( ) )
+         continue;
+
+      SYS_INF( "   priority: %s", tPriority( index - 1 ).dbg_name( ).c_str( ) );
+      for( auto p_async : collection )
       {
          SYS_INF( "      %s", p_async->signature( )->dbg_name( ).c_str( ) );
       }
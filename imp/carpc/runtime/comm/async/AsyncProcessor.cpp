@@ -1,6 +1,8 @@
 #include "carpc/runtime/comm/async/AsyncProcessor.hpp"
+#include "carpc/runtime/comm/async/Timeline.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "AsyncProc"
 
 
@@ -9,53 +11,90 @@ using namespace carpc::async;
 
 
 
-AsyncProcessor::AsyncProcessor( const std::string& name )
+AsyncProcessor::AsyncProcessor( const std::string& name, const tAsyncCollection::Configuration& configuration )
    : m_name( name )
-   , m_async_queue( name )
+   , mp_async_queue( tAsyncCollection::create( name, configuration ) )
    , m_consumers_map( name )
 {
-   SYS_VRB( "'%s': created", m_name.c_str( ) );
+   if( nullptr == mp_async_queue )
+   {
+      SYS_ERR( "'%s': unable to create %s => default queue will be used", m_name.c_str( ), c_str( configuration.type ) );
+      mp_async_queue = tAsyncCollection::create( name, { } );
+   }
+
+   RT_VRB( "'%s': created", m_name.c_str( ) );
 }
 
 AsyncProcessor::~AsyncProcessor( )
 {
-   SYS_VRB( "'%s': destroyed", m_name.c_str( ) );
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
 }
 
-bool AsyncProcessor::insert_async( const IAsync::tSptr p_async )
+bool AsyncProcessor::insert_async( IAsync::tSptr p_async )
 {
    if( false == is_subscribed( p_async ) )
    {
-      SYS_INF( "'%s': there are no consumers for async object '%s'",
+      RT_DBG( "'%s': there are no consumers for async object '%s'",
             m_name.c_str( ),
             p_async->signature( )->dbg_name( ).c_str( )
          );
       return false;
    }
 
-   return m_async_queue.insert( p_async );
+   // Async object what could be released by other producer counts references atomically
+   // even if it is inserted and processed by the same os thread.
+   if( true == mp_async_queue->is_droppable( *p_async ) )
+      p_async->share( );
+
+   timeline::record( timeline::eStage::INSERT, *p_async );
+   if( false == mp_async_queue->insert( std::move( p_async ) ) )
+      return false;
+
+   m_metrics.on_enqueued( );
+   return true;
+}
+
+void AsyncProcessor::bind_consumer( )
+{
+   mp_async_queue->bind_consumer( );
 }
 
 IAsync::tSptr AsyncProcessor::get_async( )
 {
-   return m_async_queue.get( );
+   IAsync::tSptr p_async = mp_async_queue->get( );
+   // Queue returns nothing in case if it has been frozen or stopped.
+   if( p_async )
+      timeline::record( timeline::eStage::GET, *p_async );
+   return p_async;
 }
 
-void AsyncProcessor::notify_consumers( const IAsync::tSptr p_async )
+std::size_t AsyncProcessor::get_async( tAsyncCollection::tBatch& batch, const std::size_t max_count )
 {
+   const std::size_t count = mp_async_queue->get_batch( batch, max_count );
+   if( timeline::is_enabled( ) )
+      for( auto iterator = batch.end( ) - count; iterator != batch.end( ); ++iterator )
+         timeline::record( timeline::eStage::GET, **iterator );
+   return count;
+}
+
+void AsyncProcessor::notify_consumers( const IAsync::tSptr& p_async )
+{
+   const std::int64_t started_ns = async::metrics::now_ns( );
+   timeline::record( timeline::eStage::PROCESS_BEGIN, *p_async );
+
    switch( p_async->type( ) )
    {
       case async::eAsyncType::CALLABLE:
       case async::eAsyncType::RUNNABLE:
       {
          process_start( );
-         SYS_VRB( "'%s': start processing runnable at %ld (%s)",
+         RT_VRB( "'%s': start processing runnable at %ld (%s)",
                m_name.c_str( ),
                process_started( ),
                p_async->signature( )->dbg_name( ).c_str( )
             );
          p_async->process( );
-         SYS_VRB( "'%s': finished processing runnable started at %ld (%s)",
+         RT_VRB( "'%s': finished processing runnable started at %ld (%s)",
                m_name.c_str( ),
                process_started( ),
                p_async->signature( )->dbg_name( ).c_str( )
@@ -72,6 +111,14 @@ void AsyncProcessor::notify_consumers( const IAsync::tSptr p_async )
       }
       default: break;
    }
+
+   timeline::record( timeline::eStage::PROCESS_END, *p_async );
+   const std::int64_t dispatched_ns = p_async->dispatched_ns( );
+   m_metrics.on_processed(
+         p_async->signature( )->type_id( ),
+         0 == dispatched_ns || dispatched_ns > started_ns ? 0 : started_ns - dispatched_ns,
+         async::metrics::now_ns( ) - started_ns
+      );
 }
 
 void AsyncProcessor::set_notification( const IAsync::ISignature::tSptr p_signature, IAsync::IConsumer* p_consumer )
@@ -89,7 +136,7 @@ void AsyncProcessor::clear_all_notifications( const IAsync::ISignature::tSptr p_
    m_consumers_map.clear_all_notifications( p_signature, p_consumer );
 }
 
-bool AsyncProcessor::is_subscribed( const IAsync::tSptr p_async )
+bool AsyncProcessor::is_subscribed( const IAsync::tSptr& p_async )
 {
    switch( p_async->type( ) )
    {
@@ -106,11 +153,25 @@ bool AsyncProcessor::is_subscribed( const IAsync::tSptr p_async )
    return false;
 }
 
+async::metrics::Snapshot AsyncProcessor::metrics( ) const
+{
+   async::metrics::Snapshot snapshot;
+   snapshot.name = m_name;
+   m_metrics.fill( snapshot );
+   snapshot.depth = mp_async_queue->size( );
+   snapshot.peak_depth = mp_async_queue->high_watermark( );
+   snapshot.rejected = mp_async_queue->rejected( );
+   snapshot.dropped = mp_async_queue->dropped( );
+   snapshot.signatures = m_consumers_map.signatures( );
+   snapshot.subscriptions = m_consumers_map.subscriptions( );
+   return snapshot;
+}
+
 void AsyncProcessor::dump( ) const
 {
    SYS_DUMP_START( );
    SYS_INF( "%s:", m_name.c_str( ) );
-   m_async_queue.dump( );
+   mp_async_queue->dump( );
    m_consumers_map.dump( );
    SYS_DUMP_END( );
 }
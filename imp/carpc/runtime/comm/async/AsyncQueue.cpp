@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <iterator>
+
 #include "carpc/runtime/comm/async/event/Event.hpp"
 #include "carpc/runtime/comm/async/AsyncQueue.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "AsyncQueue"
 
 
@@ -10,65 +14,178 @@ using namespace carpc::async;
 
 
 
-AsyncQueue::AsyncQueue( const std::string& name )
-   : m_name( name )
+AsyncQueue::AsyncQueue( const std::string& name, const Configuration& configuration )
+   : IAsyncQueue( name, configuration )
 {
-   SYS_VRB( "'%s': created", m_name.c_str( ) );
+   RT_VRB( "'%s': created", m_name.c_str( ) );
 }
 
 AsyncQueue::~AsyncQueue( )
 {
-   SYS_VRB( "'%s': destroyed", m_name.c_str( ) );
+   RT_VRB( "'%s': destroyed", m_name.c_str( ) );
 }
 
-bool AsyncQueue::insert( const IAsync::tSptr p_async )
+bool AsyncQueue::insert( IAsync::tSptr p_async )
 {
    if( m_freezed.load( ) )
    {
-      SYS_VRB( "'%s': async object (%s) can't be inserted, because of collection is freezed",
+      RT_VRB( "'%s': async object (%s) can't be inserted, because of collection is freezed",
          m_name.c_str( ),
          p_async->signature( )->dbg_name( ).c_str( )
       );
       return false;
    }
 
-   SYS_VRB( "'%s': inserting async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
+   RT_VRB( "'%s': inserting async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
    m_buffer_cond_var.lock( );
-   m_collection.push_back( p_async );
+   if( true == try_conflate( p_async ) )
+   {
+      m_buffer_cond_var.unlock( );
+      return true;
+   }
+
+   while( is_full( ) )
+   {
+      if( eOverflowPolicy::BLOCK == m_overflow_policy )
+      {
+         m_buffer_cond_var.unlock( );
+         if( false == wait_for_space( ) )
+         {
+            on_rejected( p_async );
+            return false;
+         }
+         m_buffer_cond_var.lock( );
+         continue;
+      }
+
+      if( false == make_space( p_async ) )
+      {
+         m_buffer_cond_var.unlock( );
+         on_rejected( p_async );
+         return false;
+      }
+   }
+   m_collection.push_back( std::move( p_async ) );
+   add_conflated( &m_collection.back( ) );
+   on_inserted( );
    m_buffer_cond_var.notify( );
    m_buffer_cond_var.unlock( );
 
    return true;
 }
 
+bool AsyncQueue::make_space( const IAsync::tSptr& p_async )
+{
+   if( true == m_collection.empty( ) )
+      return false;
+
+   auto iterator = m_collection.end( );
+   switch( m_overflow_policy )
+   {
+      case eOverflowPolicy::DROP_OLDEST:
+      {
+         iterator = m_collection.begin( );
+         break;
+      }
+      case eOverflowPolicy::DROP_LOWEST_PRIORITY:
+      {
+         iterator = std::min_element( m_collection.begin( ), m_collection.end( ),
+               []( const IAsync::tSptr& p_lhs, const IAsync::tSptr& p_rhs )
+               {
+                  return p_lhs->priority( ).value( ) < p_rhs->priority( ).value( );
+               }
+            );
+         if( ( *iterator )->priority( ).value( ) > p_async->priority( ).value( ) )
+            return false;
+         break;
+      }
+      default:
+      {
+         return false;
+      }
+   }
+
+   on_dropped( *iterator );
+   if( m_collection.begin( ) == iterator )
+   {
+      remove_conflated( &( *iterator ) );
+      m_collection.erase( iterator );
+   }
+   else
+   {
+      // Erasing from the middle invalidates all references => conflation slots must be rebuilt
+      m_collection.erase( iterator );
+      clear_conflated( );
+      for( auto& p_element : m_collection )
+         add_conflated( &p_element );
+   }
+   m_size.fetch_sub( 1 );
+   return true;
+}
+
 IAsync::tSptr AsyncQueue::get( )
 {
+   bind_consumer( );
+   const bool waited = spin_for_data( );
    m_buffer_cond_var.lock( );
-   if( true == m_collection.empty( ) )
+   while( true == m_collection.empty( ) )
    {
-      SYS_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
       m_buffer_cond_var.wait( );
    }
-   IAsync::tSptr p_async = m_collection.front( );
+   remove_conflated( &m_collection.front( ) );
+   IAsync::tSptr p_async = std::move( m_collection.front( ) );
    m_collection.pop_front( );
-   SYS_VRB( "'%s': received async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
+   RT_VRB( "'%s': received async object (%s)", m_name.c_str( ), p_async->signature( )->dbg_name( ).c_str( ) );
    m_buffer_cond_var.unlock( );
+   on_extracted( );
+   if( waited )
+      on_woken_up( );
 
    return p_async;
 }
 
+std::size_t AsyncQueue::get_batch( tBatch& batch, const std::size_t max_count )
+{
+   bind_consumer( );
+   const bool waited = spin_for_data( );
+   m_buffer_cond_var.lock( );
+   while( true == m_collection.empty( ) )
+   {
+      RT_VRB( "'%s': waiting for async object...", m_name.c_str( ) );
+      m_buffer_cond_var.wait( );
+   }
+   const std::size_t count = std::min( std::max( max_count, std::size_t{ 1 } ), m_collection.size( ) );
+   const auto end = m_collection.begin( ) + count;
+   for( auto iterator = m_collection.begin( ); iterator != end; ++iterator )
+      remove_conflated( &( *iterator ) );
+   std::move( m_collection.begin( ), end, std::back_inserter( batch ) );
+   m_collection.erase( m_collection.begin( ), end );
+   RT_VRB( "'%s': received %zu async object(s)", m_name.c_str( ), count );
+   m_buffer_cond_var.unlock( );
+   on_extracted( count );
+   if( waited )
+      on_woken_up( );
+
+   return count;
+}
+
 void AsyncQueue::clear( )
 {
    m_buffer_cond_var.lock( );
    SYS_INF( "clearing collection..." );
+   const std::size_t count = m_collection.size( );
    m_collection.clear( );
+   clear_conflated( );
    m_buffer_cond_var.unlock( );
+   on_extracted( count );
 }
 
 void AsyncQueue::dump( ) const
 {
    SYS_WRN( "------------------------- START DUMP -------------------------" );
    SYS_INF( "%s:", m_name.c_str( ) );
+   dump_statistics( );
    for( const auto& element : m_collection )
    {
       SYS_INF( "%s", element->signature( )->dbg_name( ).c_str( ) );
@@ -1,7 +1,11 @@
 #include "carpc/runtime/application/Process.hpp"
 #include "carpc/runtime/comm/async/IAsync.hpp"
+#include "carpc/runtime/comm/async/Metrics.hpp"
+#include "carpc/runtime/comm/async/SubscriptionIndex.hpp"
+#include "carpc/runtime/comm/async/Timeline.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "IAsync"
 
 
@@ -9,18 +13,34 @@ using namespace carpc::async;
 
 
 
+IAsync::IAsync( )
+   : m_timeline_id( timeline::on_created( ) )
+{
+}
+
 const bool IAsync::dispatch( const application::Context& to_context )
 {
    const char* const async_name = name( type( ) );
-   auto p_async = shared_from_this( );
-   SYS_VRB( "%s: %s", async_name, p_async->signature( )->dbg_name( ).c_str( ) );
+   // The only reference taken by dispatching: it is moved to the queue of destination thread.
+   // It is counted without atomic operation till async object is shared with other os thread.
+   IAsync::tSptr p_async( this );
+   m_dispatched_ns.store( metrics::now_ns( ), std::memory_order_relaxed );
+   timeline::record( timeline::eStage::DISPATCH, *this );
+   RT_VRB( "%s: %s", async_name, p_async->signature( )->dbg_name( ).c_str( ) );
 
    if( to_context.is_external( ) )
    {
       if( eAsyncType::EVENT == type( ) )
       {
-         SYS_INF( "sending IPC %s", async_name );
-         application::IThread::tSptr p_thread_ipc = application::Process::instance( )->thread_ipc( );
+         RT_DBG( "sending IPC %s", async_name );
+         application::Process::tRptr p_process = application::Process::raw_instance( );
+         if( nullptr == p_process )
+         {
+            SYS_ERR( "sending IPC %s without application process", async_name );
+            return false;
+         }
+
+         application::IThread::tSptr p_thread_ipc = p_process->thread_ipc( );
          if( nullptr == p_thread_ipc )
          {
             SYS_ERR( "application IPC thread is not started" );
@@ -37,50 +57,75 @@ const bool IAsync::dispatch( const application::Context& to_context )
    }
    else if( application::thread::broadcast == to_context.tid( ) )
    {
-      SYS_INF( "sending broadcast %s to all application threads", async_name );
+      RT_DBG( "sending broadcast %s to all application threads", async_name );
+
+      // Each thread checks its own subscription bit before insertion, but in case if nobody
+      // is subscribed no thread is touched at all. Subscribers without the bit could have
+      // subscriptions what are not reflected in the bitmask.
+      const SubscriptionIndex& index = SubscriptionIndex::instance( );
+      if( eAsyncType::EVENT == type( ) && false == index.has_unindexed( ) && 0 == index.subscribers( signature( )->hash( ) ) )
+      {
+         RT_DBG( "there are no consumers for %s", async_name );
+         return false;
+      }
+
+      application::Process::tRptr p_process = application::Process::raw_instance( );
+      if( nullptr == p_process )
+      {
+         SYS_ERR( "sending broadcast %s without application process", async_name );
+         return false;
+      }
+
       bool result = true;
 
-      application::IThread::tSptr p_thread_ipc = application::Process::instance( )->thread_ipc( );
+      application::IThread::tSptr p_thread_ipc = p_process->thread_ipc( );
       if( nullptr != p_thread_ipc )
       {
          result &= p_thread_ipc->insert_async( p_async );
       }
 
-      application::IThread::tSptrList thread_list = carpc::application::Process::instance( )->thread_list( );
-      for( auto p_thread : thread_list )
+      const application::IThread::tSptrList& thread_list = p_process->thread_list( );
+      for( const auto& p_thread : thread_list )
          result &= p_thread->insert_async( p_async );
 
       return result;
    }
    else if( application::thread::local == to_context.tid( ) )
    {
-      SYS_INF( "sending %s to current application thread: %s"
+      RT_DBG( "sending %s to current application thread: %s"
             , async_name
             , to_context.tid( ).dbg_name( ).c_str( )
          );
-      application::IThread::tSptr p_thread = carpc::application::Process::instance( )->current_thread( );
+      application::IThread::tRptr p_thread = application::IThread::current( );
       if( nullptr == p_thread )
       {
          SYS_ERR( "sending local %s not from application thread", async_name );
          return false;
       }
 
-      return p_thread->insert_async( p_async );
+      return p_thread->insert_async( std::move( p_async ) );
    }
    else
    {
-      SYS_INF( "sending %s to %s application thread"
+      RT_DBG( "sending %s to %s application thread"
             , async_name
             , to_context.tid( ).dbg_name( ).c_str( )
          );
-      application::IThread::tSptr p_thread = carpc::application::Process::instance( )->thread( to_context.tid( ) );
+      application::Process::tRptr p_process = application::Process::raw_instance( );
+      if( nullptr == p_process )
+      {
+         SYS_ERR( "sending %s without application process", async_name );
+         return false;
+      }
+
+      application::IThread::tSptr p_thread = p_process->thread( to_context.tid( ) );
       if( nullptr == p_thread )
       {
          SYS_ERR( "sending %s to unknown application thread", async_name );
          return false;
       }
 
-      return p_thread->insert_async( p_async );
+      return p_thread->insert_async( std::move( p_async ) );
    }
 
    return true;
@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
+#include "carpc/runtime/application/IThread.hpp"
+#include "carpc/runtime/common/CpuRelax.hpp"
+#include "carpc/runtime/comm/async/AsyncQueue.hpp"
+#include "carpc/runtime/comm/async/AsyncPriorityQueue.hpp"
+#include "carpc/runtime/comm/async/AsyncLockFreeQueue.hpp"
+#include "carpc/runtime/comm/async/AsyncDeadlineQueue.hpp"
+#include "carpc/runtime/comm/async/IAsyncQueue.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
+#define CLASS_ABBR "IAsyncQueue"
+
+
+
+using namespace carpc::async;
+
+
+
+namespace {
+
+   std::int64_t now_ns( )
+   {
+      return std::chrono::duration_cast< std::chrono::nanoseconds >(
+            std::chrono::steady_clock::now( ).time_since_epoch( )
+         ).count( );
+   }
+
+}
+
+
+
+IAsyncQueue::tSptr IAsyncQueue::create( const std::string& name, const Configuration& configuration )
+{
+   RT_VRB( "'%s': creating %s (capacity: %zu, overflow policy: %s)",
+         name.c_str( ),
+         c_str( configuration.type ),
+         configuration.capacity,
+         c_str( configuration.overflow_policy )
+      );
+
+   switch( configuration.type )
+   {
+      case eAsyncQueueType::FIFO:         return std::make_shared< AsyncQueue >( name, configuration );
+      case eAsyncQueueType::PRIORITY:     return std::make_shared< AsyncPriorityQueue >( name, tPriority::max, configuration );
+      case eAsyncQueueType::LOCK_FREE:    return std::make_shared< AsyncLockFreeQueue >( name, configuration );
+      case eAsyncQueueType::DEADLINE:     return std::make_shared< AsyncDeadlineQueue >( name, configuration );
+      default:                            break;
+   }
+
+   SYS_ERR( "'%s': unknown queue type", name.c_str( ) );
+   return nullptr;
+}
+
+IAsyncQueue::IAsyncQueue( const std::string& name, const Configuration& configuration )
+   : m_name( name )
+   , m_wait_strategy( configuration.wait_strategy )
+   , m_spin_count( configuration.spin_count )
+   , m_capacity( configuration.capacity )
+   , m_overflow_policy( configuration.overflow_policy )
+{
+}
+
+bool IAsyncQueue::is_droppable( const IAsync& async ) const
+{
+   if( true == async.is_conflated( ) )
+      return true;
+
+   return 0 != m_capacity
+      && ( eOverflowPolicy::DROP_OLDEST == m_overflow_policy || eOverflowPolicy::DROP_LOWEST_PRIORITY == m_overflow_policy );
+}
+
+void IAsyncQueue::freeze( )
+{
+   m_freezed.store( true );
+   // Blocked producers should not wait for space in freezed queue
+   std::lock_guard< std::mutex > lock( m_space_mutex );
+   m_space_cond_var.notify_all( );
+}
+
+void IAsyncQueue::unfreeze( )
+{
+   m_freezed.store( false );
+}
+
+bool IAsyncQueue::wait_for_space( )
+{
+   // Consumer can't wait for itself
+   if( std::this_thread::get_id( ) == m_consumer_id.load( std::memory_order_relaxed ) )
+   {
+      SYS_WRN( "'%s': queue is full and can't be blocked from consumer context", m_name.c_str( ) );
+      return false;
+   }
+   // Worker acts as consumer of its application thread and owner thread could wait for it
+   // (see 'Workers::stop') without processing the queue.
+   if( true == application::IThread::is_worker( ) )
+   {
+      SYS_WRN( "'%s': queue is full and can't be blocked from worker context", m_name.c_str( ) );
+      return false;
+   }
+
+   // 'm_space_waiters' increment and 'm_size' check are sequentially consistent with
+   // 'm_size' decrement and 'm_space_waiters' check in 'notify_space' => wake up can't be lost.
+   std::unique_lock< std::mutex > lock( m_space_mutex );
+   m_space_waiters.fetch_add( 1 );
+   while( is_full( ) && false == is_freezed( ) )
+   {
+      RT_VRB( "'%s': waiting for space...", m_name.c_str( ) );
+      m_space_cond_var.wait( lock );
+   }
+   m_space_waiters.fetch_sub( 1 );
+   lock.unlock( );
+
+   return false == is_freezed( );
+}
+
+void IAsyncQueue::notify_space( )
+{
+   if( 0 == m_space_waiters.load( ) )
+      return;
+
+   // Several slots could be released at once and each waiter rechecks free space by itself.
+   std::lock_guard< std::mutex > lock( m_space_mutex );
+   m_space_cond_var.notify_all( );
+}
+
+void IAsyncQueue::on_inserted( )
+{
+   const std::size_t size = m_size.fetch_add( 1 ) + 1;
+   if( 1 == size )
+      mark_data_time( );
+   update_high_watermark( size );
+}
+
+void IAsyncQueue::mark_data_time( )
+{
+   m_data_time_ns.store( now_ns( ), std::memory_order_relaxed );
+}
+
+bool IAsyncQueue::spin_for_data( )
+{
+   if( 0 != m_size.load( ) )
+      return false;
+
+   switch( m_wait_strategy )
+   {
+      case eWaitStrategy::SPIN_PARK:
+      {
+         for( std::size_t count = 0; count < m_spin_count && 0 == m_size.load( std::memory_order_relaxed ); ++count )
+            cpu_relax( );
+         break;
+      }
+      case eWaitStrategy::BUSY_POLL:
+      {
+         while( 0 == m_size.load( std::memory_order_relaxed ) )
+            cpu_relax( );
+         break;
+      }
+      default: break;
+   }
+
+   return true;
+}
+
+void IAsyncQueue::on_woken_up( )
+{
+   const std::int64_t latency = now_ns( ) - m_data_time_ns.load( std::memory_order_relaxed );
+   if( 0 > latency )
+      return;
+
+   m_wake_ups.fetch_add( 1, std::memory_order_relaxed );
+   m_wake_up_latency_total_ns.fetch_add( latency, std::memory_order_relaxed );
+   std::uint64_t max = m_wake_up_latency_max_ns.load( std::memory_order_relaxed );
+   while( static_cast< std::uint64_t >( latency ) > max
+      && false == m_wake_up_latency_max_ns.compare_exchange_weak( max, latency )
+   );
+}
+
+void IAsyncQueue::update_high_watermark( const std::size_t size )
+{
+   std::size_t high_watermark = m_high_watermark.load( std::memory_order_relaxed );
+   while( size > high_watermark && false == m_high_watermark.compare_exchange_weak( high_watermark, size ) );
+}
+
+void IAsyncQueue::on_rejected( const IAsync::tSptr& p_async )
+{
+   m_rejected.fetch_add( 1, std::memory_order_relaxed );
+   SYS_WRN( "'%s': queue is full (%zu) => async object (%s) is rejected",
+         m_name.c_str( ),
+         m_capacity,
+         p_async->signature( )->dbg_name( ).c_str( )
+      );
+}
+
+void IAsyncQueue::on_dropped( const IAsync::tSptr& p_async )
+{
+   m_dropped.fetch_add( 1, std::memory_order_relaxed );
+   SYS_WRN( "'%s': queue is full (%zu) => async object (%s) is dropped",
+         m_name.c_str( ),
+         m_capacity,
+         p_async->signature( )->dbg_name( ).c_str( )
+      );
+}
+
+bool IAsyncQueue::try_conflate( const IAsync::tSptr& p_async )
+{
+   if( m_conflated_slots.empty( ) || false == p_async->is_conflated( ) )
+      return false;
+
+   const auto& signature = *( p_async->signature( ) );
+   for( IAsync::tSptr* p_slot : m_conflated_slots )
+   {
+      if( ( *p_slot )->signature( )->operator==( signature ) )
+      {
+         RT_VRB( "'%s': async object (%s) is conflated", m_name.c_str( ), signature.dbg_name( ).c_str( ) );
+         *p_slot = p_async;
+         m_conflated.fetch_add( 1, std::memory_order_relaxed );
+         return true;
+      }
+   }
+
+   return false;
+}
+
+void IAsyncQueue::add_conflated( IAsync::tSptr* p_slot )
+{
+   if( ( *p_slot )->is_conflated( ) )
+      m_conflated_slots.push_back( p_slot );
+}
+
+void IAsyncQueue::remove_conflated( const IAsync::tSptr* p_slot )
+{
+   if( m_conflated_slots.empty( ) )
+      return;
+
+   auto iterator = std::find( m_conflated_slots.begin( ), m_conflated_slots.end( ), p_slot );
+   if( m_conflated_slots.end( ) == iterator )
+      return;
+
+   *iterator = m_conflated_slots.back( );
+   m_conflated_slots.pop_back( );
+}
+
+void IAsyncQueue::clear_conflated( )
+{
+   m_conflated_slots.clear( );
+}
+
+void IAsyncQueue::dump_statistics( ) const
+{
+   SYS_INF( "   size: %zu / capacity: %zu / high watermark: %zu / rejected: %zu / dropped: %zu / conflated: %zu (%s)",
+         m_size.load( ),
+         m_capacity,
+         m_high_watermark.load( ),
+         m_rejected.load( ),
+         m_dropped.load( ),
+         m_conflated.load( ),
+         c_str( m_overflow_policy )
+      );
+   SYS_INF( "   wake ups: %zu / wake up latency avg: %" PRIu64 " ns / max: %" PRIu64 " ns (%s)",
+         m_wake_ups.load( ),
+         wake_up_latency_avg_ns( ),
+         m_wake_up_latency_max_ns.load( ),
+         c_str( m_wait_strategy )
+      );
+}
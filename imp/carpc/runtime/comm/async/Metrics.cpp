@@ -0,0 +1,191 @@
+#include <chrono>
+#include <cinttypes>
+
+#include "carpc/runtime/comm/async/Metrics.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "Metrics"
+
+
+
+using namespace carpc::async::metrics;
+
+
+
+std::int64_t carpc::async::metrics::now_ns( )
+{
+   return std::chrono::duration_cast< std::chrono::nanoseconds >(
+         std::chrono::steady_clock::now( ).time_since_epoch( )
+      ).count( );
+}
+
+
+
+std::size_t Counter::shard( )
+{
+   static std::atomic< std::size_t > s_next = 0;
+   thread_local const std::size_t s_shard = s_next.fetch_add( 1, std::memory_order_relaxed ) % s_shards;
+   return s_shard;
+}
+
+void Counter::add( const std::uint64_t value )
+{
+   m_shards[ shard( ) ].value.fetch_add( value, std::memory_order_relaxed );
+}
+
+std::uint64_t Counter::value( ) const
+{
+   std::uint64_t result = 0;
+   for( const Shard& shard : m_shards )
+      result += shard.value.load( std::memory_order_relaxed );
+   return result;
+}
+
+
+
+std::size_t Histogram::bucket( const std::uint64_t value )
+{
+   // Values below two sub-bucket ranges are mapped linearly.
+   if( value < 2 * s_sub_buckets )
+      return static_cast< std::size_t >( value );
+
+   const std::size_t msb = 63 - __builtin_clzll( value );
+   const std::size_t shift = msb - s_sub_bucket_bits;
+   return ( shift + 1 ) * s_sub_buckets + static_cast< std::size_t >( ( value >> shift ) - s_sub_buckets );
+}
+
+std::uint64_t Histogram::lowest( const std::size_t bucket )
+{
+   if( bucket < 2 * s_sub_buckets )
+      return bucket;
+
+   const std::size_t shift = bucket / s_sub_buckets - 1;
+   return ( s_sub_buckets + bucket % s_sub_buckets ) << shift;
+}
+
+void Histogram::record( const std::uint64_t value )
+{
+   // Single writer: load and store are enough and are cheaper then read-modify-write operations.
+   auto& counter = m_buckets[ bucket( value ) ];
+   counter.store( counter.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+   m_total.store( m_total.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+   if( value > m_max.load( std::memory_order_relaxed ) )
+      m_max.store( value, std::memory_order_relaxed );
+   m_count.store( m_count.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+}
+
+std::uint64_t Histogram::count( ) const
+{
+   return m_count.load( std::memory_order_relaxed );
+}
+
+std::uint64_t Histogram::max( ) const
+{
+   return m_max.load( std::memory_order_relaxed );
+}
+
+std::uint64_t Histogram::percentile( const double percent ) const
+{
+   // Buckets are summed instead of using 'm_count', because they could be updated
+   // by writer during reading.
+   std::uint64_t total = 0;
+   for( const auto& counter : m_buckets )
+      total += counter.load( std::memory_order_relaxed );
+   if( 0 == total )
+      return 0;
+
+   std::uint64_t rank = static_cast< std::uint64_t >( percent / 100.0 * static_cast< double >( total ) + 0.5 );
+   if( 0 == rank )
+      rank = 1;
+
+   std::uint64_t accumulated = 0;
+   for( std::size_t index = 0; index < s_buckets; ++index )
+   {
+      accumulated += m_buckets[ index ].load( std::memory_order_relaxed );
+      if( accumulated >= rank )
+         return lowest( index );
+   }
+   return max( );
+}
+
+Histogram::Summary Histogram::summary( ) const
+{
+   Summary summary;
+   summary.count = count( );
+   summary.mean = 0 == summary.count ? 0 : m_total.load( std::memory_order_relaxed ) / summary.count;
+   summary.p50 = percentile( 50.0 );
+   summary.p90 = percentile( 90.0 );
+   summary.p99 = percentile( 99.0 );
+   summary.max = max( );
+   return summary;
+}
+
+
+
+void Snapshot::dump( ) const
+{
+   SYS_DUMP_START( );
+   SYS_INF( "%s: enqueued: %" PRIu64 " / dequeued: %" PRIu64 " / depth: %zu / peak depth: %zu / rejected: %zu / dropped: %zu",
+         name.c_str( ), enqueued, dequeued, depth, peak_depth, rejected, dropped
+      );
+   SYS_INF( "   signatures: %zu / subscriptions: %zu", signatures, subscriptions );
+   for( const auto& type : types )
+   {
+      SYS_INF( "   %s:", type.name.c_str( ) );
+      SYS_INF( "      queue wait (ns): count: %" PRIu64 " / mean: %" PRIu64 " / p50: %" PRIu64 " / p90: %" PRIu64 " / p99: %" PRIu64 " / max: %" PRIu64,
+            type.queue_wait.count, type.queue_wait.mean,
+            type.queue_wait.p50, type.queue_wait.p90, type.queue_wait.p99, type.queue_wait.max
+         );
+      SYS_INF( "      processing (ns): count: %" PRIu64 " / mean: %" PRIu64 " / p50: %" PRIu64 " / p90: %" PRIu64 " / p99: %" PRIu64 " / max: %" PRIu64,
+            type.processing.count, type.processing.mean,
+            type.processing.p50, type.processing.p90, type.processing.p99, type.processing.max
+         );
+   }
+   SYS_DUMP_END( );
+}
+
+
+
+void Collector::on_enqueued( )
+{
+   m_enqueued.add( );
+}
+
+void Collector::on_processed( const tAsyncTypeID& type_id, const std::uint64_t queue_wait_ns, const std::uint64_t processing_ns )
+{
+   m_dequeued.store( m_dequeued.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+
+   if( nullptr == mp_last_type_id || *mp_last_type_id != type_id )
+   {
+      auto iterator = m_types.find( type_id );
+      if( m_types.end( ) == iterator )
+      {
+         auto p_type = std::make_unique< Type >( );
+         p_type->name = type_id.dbg_name( );
+         std::lock_guard< std::mutex > lock( m_types_mutex );
+         iterator = m_types.emplace( type_id, std::move( p_type ) ).first;
+      }
+      mp_last_type_id = &iterator->first;
+      mp_last_type = iterator->second.get( );
+   }
+
+   mp_last_type->queue_wait.record( queue_wait_ns );
+   mp_last_type->processing.record( processing_ns );
+}
+
+void Collector::fill( Snapshot& snapshot ) const
+{
+   snapshot.enqueued = m_enqueued.value( );
+   snapshot.dequeued = m_dequeued.load( std::memory_order_relaxed );
+
+   std::lock_guard< std::mutex > lock( m_types_mutex );
+   snapshot.types.reserve( m_types.size( ) );
+   for( const auto& pair : m_types )
+   {
+      snapshot.types.push_back( {
+            pair.second->name,
+            pair.second->queue_wait.summary( ),
+            pair.second->processing.summary( )
+         } );
+   }
+}
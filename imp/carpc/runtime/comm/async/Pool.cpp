@@ -0,0 +1,60 @@
+#include "carpc/runtime/comm/async/Pool.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "Pool"
+
+
+
+using namespace carpc::async::pool;
+
+
+
+namespace {
+
+   std::mutex& registry_mutex( )
+   {
+      static std::mutex* sp_mutex = new std::mutex;
+      return *sp_mutex;
+   }
+
+   // Registry is never destroyed as well as pools themselves.
+   std::vector< Statistics* >& registry( )
+   {
+      static std::vector< Statistics* >* sp_registry = new std::vector< Statistics* >;
+      return *sp_registry;
+   }
+
+}
+
+
+
+Statistics::Statistics( const std::size_t _block_size, const std::size_t _alignment )
+   : block_size( _block_size )
+   , alignment( _alignment )
+{
+}
+
+void carpc::async::pool::__private__::register_statistics( Statistics* p_statistics )
+{
+   std::lock_guard< std::mutex > lock( registry_mutex( ) );
+   registry( ).push_back( p_statistics );
+}
+
+void carpc::async::pool::dump( )
+{
+   std::lock_guard< std::mutex > lock( registry_mutex( ) );
+
+   SYS_DUMP_START( );
+   for( const Statistics* p_statistics : registry( ) )
+   {
+      SYS_INF( "block %zu/%zu: allocated: %zu / reused: %zu / released: %zu / freed: %zu",
+            p_statistics->block_size,
+            p_statistics->alignment,
+            p_statistics->allocated.load( ),
+            p_statistics->reused.load( ),
+            p_statistics->released.load( ),
+            p_statistics->freed.load( )
+         );
+   }
+   SYS_DUMP_END( );
+}
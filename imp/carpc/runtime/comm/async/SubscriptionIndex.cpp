@@ -0,0 +1,91 @@
+#include "carpc/runtime/comm/async/SubscriptionIndex.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "SubscriptionIndex"
+
+
+
+using namespace carpc::async;
+
+
+
+SubscriptionIndex& SubscriptionIndex::instance( )
+{
+   // Index is never destroyed, because consumer maps could be destroyed after static objects.
+   static SubscriptionIndex* sp_instance = new SubscriptionIndex;
+   return *sp_instance;
+}
+
+SubscriptionIndex::tSubscriber SubscriptionIndex::attach( )
+{
+   std::lock_guard< std::mutex > lock( m_mutex );
+   for( tSubscriber subscriber = 0; subscriber < s_max_subscribers; ++subscriber )
+   {
+      const tMask bit = tMask{ 1 } << subscriber;
+      if( 0 != ( m_attached & bit ) )
+         continue;
+
+      m_attached |= bit;
+      return subscriber;
+   }
+
+   SYS_WRN( "max number of subscribers %zu is reached => subscriber will be treated as subscribed to everything", s_max_subscribers );
+   m_unindexed.fetch_add( 1, std::memory_order_release );
+   return s_invalid;
+}
+
+void SubscriptionIndex::detach( const tSubscriber subscriber )
+{
+   if( s_invalid == subscriber )
+   {
+      m_unindexed.fetch_sub( 1, std::memory_order_release );
+      return;
+   }
+
+   std::lock_guard< std::mutex > lock( m_mutex );
+   const tMask bit = tMask{ 1 } << subscriber;
+   for( auto iterator = m_counts.begin( ); iterator != m_counts.end( ); )
+   {
+      if( subscriber != iterator->first % s_max_subscribers )
+      {
+         ++iterator;
+         continue;
+      }
+
+      m_masks[ iterator->first / s_max_subscribers ].fetch_and( ~bit, std::memory_order_release );
+      iterator = m_counts.erase( iterator );
+   }
+   m_attached &= ~bit;
+}
+
+void SubscriptionIndex::add( const tSubscriber subscriber, const std::size_t hash )
+{
+   if( s_invalid == subscriber )
+      return;
+
+   const std::size_t index = bucket( hash );
+   std::lock_guard< std::mutex > lock( m_mutex );
+   if( 1 == ++m_counts[ index * s_max_subscribers + subscriber ] )
+      m_masks[ index ].fetch_or( tMask{ 1 } << subscriber, std::memory_order_release );
+}
+
+void SubscriptionIndex::remove( const tSubscriber subscriber, const std::size_t hash )
+{
+   if( s_invalid == subscriber )
+      return;
+
+   const std::size_t index = bucket( hash );
+   std::lock_guard< std::mutex > lock( m_mutex );
+   auto iterator = m_counts.find( index * s_max_subscribers + subscriber );
+   if( m_counts.end( ) == iterator )
+   {
+      SYS_WRN( "subscriber %zu does not have subscriptions in bucket %zu", subscriber, index );
+      return;
+   }
+
+   if( 0 != --iterator->second )
+      return;
+
+   m_counts.erase( iterator );
+   m_masks[ index ].fetch_and( ~( tMask{ 1 } << subscriber ), std::memory_order_release );
+}
@@ -0,0 +1,421 @@
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "carpc/runtime/application/IThread.hpp"
+#include "carpc/runtime/comm/async/Timeline.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "Timeline"
+
+
+
+using namespace carpc::async;
+using namespace carpc::async::timeline;
+
+
+
+namespace {
+
+   // Number of records in ring buffer of each thread.
+   constexpr std::size_t s_capacity = std::size_t{ 1 } << 15;
+   // Timeline id contains index of the thread buffer where async object has been created,
+   // so ids are generated without synchronization between threads.
+   constexpr std::size_t s_id_bits = 40;
+
+   // Fields are atomic because buffer could be read during writing. Each record is protected by
+   // its sequence number (seqlock): odd - record is being written, even - record is completed.
+   struct Record
+   {
+      std::atomic< std::uint64_t >     sequence = 0;
+      std::atomic< std::int64_t >      time_ns = 0;
+      std::atomic< std::uint64_t >     id = 0;
+      std::atomic< std::uint64_t >     type = 0;
+      std::atomic< std::uint64_t >     flow_id = 0;
+      std::atomic< std::uint8_t >      stage = 0;
+   };
+
+   // Copy of completed record used for export.
+   struct Entry
+   {
+      std::int64_t                     time_ns = 0;
+      std::uint64_t                    id = 0;
+      std::uint64_t                    type = 0;
+      std::uint64_t                    flow_id = 0;
+      eStage                           stage = eStage::CREATE;
+      std::size_t                      thread = 0;
+   };
+
+   struct Buffer
+   {
+      Buffer( const std::size_t _index, const std::string& _name )
+         : index( _index )
+         , name( _name )
+         , records( new Record[ s_capacity ] )
+      { }
+
+      void write( const eStage _stage, const std::uint64_t _id, const std::uint64_t _type, const std::uint64_t _flow_id )
+      {
+         const std::uint64_t position = head.load( std::memory_order_relaxed );
+         Record& record = records[ position % s_capacity ];
+         record.sequence.store( 2 * position + 1, std::memory_order_relaxed );
+         std::atomic_thread_fence( std::memory_order_release );
+         record.time_ns.store( std::chrono::duration_cast< std::chrono::nanoseconds >(
+               std::chrono::steady_clock::now( ).time_since_epoch( )
+            ).count( ), std::memory_order_relaxed );
+         record.id.store( _id, std::memory_order_relaxed );
+         record.type.store( _type, std::memory_order_relaxed );
+         record.flow_id.store( _flow_id, std::memory_order_relaxed );
+         record.stage.store( static_cast< std::uint8_t >( _stage ), std::memory_order_relaxed );
+         record.sequence.store( 2 * position + 2, std::memory_order_release );
+         head.store( position + 1, std::memory_order_release );
+      }
+
+      void read( std::vector< Entry >& entries ) const
+      {
+         const std::uint64_t end = head.load( std::memory_order_acquire );
+         std::uint64_t begin = std::max( cleared.load( std::memory_order_relaxed ), end > s_capacity ? end - s_capacity : 0 );
+         for( std::uint64_t position = begin; position < end; ++position )
+         {
+            const Record& record = records[ position % s_capacity ];
+            const std::uint64_t sequence = record.sequence.load( std::memory_order_acquire );
+            if( 2 * position + 2 != sequence )
+               continue;
+
+            Entry entry;
+            entry.time_ns = record.time_ns.load( std::memory_order_relaxed );
+            entry.id = record.id.load( std::memory_order_relaxed );
+            entry.type = record.type.load( std::memory_order_relaxed );
+            entry.flow_id = record.flow_id.load( std::memory_order_relaxed );
+            entry.stage = static_cast< eStage >( record.stage.load( std::memory_order_relaxed ) );
+            entry.thread = index;
+            std::atomic_thread_fence( std::memory_order_acquire );
+            // Record has been overwritten by writer during reading.
+            if( sequence != record.sequence.load( std::memory_order_relaxed ) )
+               continue;
+
+            entries.push_back( entry );
+         }
+      }
+
+      const std::size_t                         index;
+      // Protected by registry mutex: buffer is renamed when it is reused by another thread.
+      std::string                               name;
+      std::unique_ptr< Record[ ] >              records;
+      std::atomic< std::uint64_t >              head = 0;
+      std::atomic< std::uint64_t >              cleared = 0;
+      // Used only by owner thread.
+      std::uint64_t                             next_id = 0;
+      std::unordered_set< std::uint64_t >       known_types;
+   };
+
+   // Registry, buffers and names are never destroyed, because records could be written by
+   // destructors of static objects. Buffer of exited thread is returned to the free list
+   // and reused by the next thread with all its records and ids sequence.
+   std::mutex& registry_mutex( )
+   {
+      static std::mutex* sp_mutex = new std::mutex;
+      return *sp_mutex;
+   }
+
+   std::vector< Buffer* >& registry( )
+   {
+      static std::vector< Buffer* >* sp_registry = new std::vector< Buffer* >;
+      return *sp_registry;
+   }
+
+   std::vector< Buffer* >& free_buffers( )
+   {
+      static std::vector< Buffer* >* sp_free = new std::vector< Buffer* >;
+      return *sp_free;
+   }
+
+   std::unordered_map< std::uint64_t, std::string >& type_names( )
+   {
+      static auto* sp_names = new std::unordered_map< std::uint64_t, std::string >;
+      return *sp_names;
+   }
+
+   // Buffer of current thread. Pointer and flag are trivially destructible, so they are still
+   // accessible from destructors of other thread local objects after the holder is destroyed.
+   thread_local Buffer* tp_buffer = nullptr;
+   thread_local bool t_is_exited = false;
+
+   struct Holder
+   {
+      ~Holder( )
+      {
+         std::lock_guard< std::mutex > lock( registry_mutex( ) );
+         free_buffers( ).push_back( tp_buffer );
+         tp_buffer = nullptr;
+         t_is_exited = true;
+      }
+   };
+
+   // Returns nullptr in case if thread is exiting: nothing is recorded from this moment.
+   Buffer* buffer( )
+   {
+      if( nullptr != tp_buffer || true == t_is_exited )
+         return tp_buffer;
+
+      std::string name = "thread";
+      carpc::application::IThread::tRptr p_thread = carpc::application::IThread::current( );
+      if( nullptr != p_thread )
+         name = p_thread->name( ).c_str( );
+
+      {
+         std::lock_guard< std::mutex > lock( registry_mutex( ) );
+         if( free_buffers( ).empty( ) )
+         {
+            tp_buffer = new Buffer( registry( ).size( ) + 1, name );
+            registry( ).push_back( tp_buffer );
+         }
+         else
+         {
+            tp_buffer = free_buffers( ).back( );
+            free_buffers( ).pop_back( );
+            tp_buffer->name = std::move( name );
+         }
+      }
+
+      thread_local Holder holder;
+      return tp_buffer;
+   }
+
+   const char* label( const eStage stage )
+   {
+      switch( stage )
+      {
+         case eStage::CREATE:          return "create";
+         case eStage::DISPATCH:        return "dispatch";
+         case eStage::INSERT:          return "insert";
+         case eStage::GET:             return "get";
+         case eStage::PROCESS_BEGIN:   return "process";
+         case eStage::PROCESS_END:     return "process";
+         case eStage::IPC_SEND:        return "ipc send";
+         case eStage::IPC_RECEIVE:     return "ipc receive";
+         default:                      return "undefined";
+      }
+      return "undefined";
+   }
+
+   std::string escape( const std::string& value )
+   {
+      std::string result;
+      result.reserve( value.size( ) );
+      for( const char symbol : value )
+      {
+         if( '"' == symbol || '\\' == symbol )
+            result.push_back( '\\' );
+         if( static_cast< unsigned char >( symbol ) < 0x20 )
+            continue;
+         result.push_back( symbol );
+      }
+      return result;
+   }
+
+}
+
+
+
+namespace carpc::async::timeline {
+
+   const char* c_str( const eStage stage )
+   {
+      switch( stage )
+      {
+         case eStage::CREATE:          return "carpc::timeline::eStage::CREATE";
+         case eStage::DISPATCH:        return "carpc::timeline::eStage::DISPATCH";
+         case eStage::INSERT:          return "carpc::timeline::eStage::INSERT";
+         case eStage::GET:             return "carpc::timeline::eStage::GET";
+         case eStage::PROCESS_BEGIN:   return "carpc::timeline::eStage::PROCESS_BEGIN";
+         case eStage::PROCESS_END:     return "carpc::timeline::eStage::PROCESS_END";
+         case eStage::IPC_SEND:        return "carpc::timeline::eStage::IPC_SEND";
+         case eStage::IPC_RECEIVE:     return "carpc::timeline::eStage::IPC_RECEIVE";
+         default:                      return "carpc::timeline::eStage::UNEFINED";
+      }
+      return "carpc::timeline::eStage::UNEFINED";
+   }
+
+}
+
+
+
+std::atomic< bool >& carpc::async::timeline::__private__::enabled( )
+{
+   static std::atomic< bool > s_enabled = false;
+   return s_enabled;
+}
+
+void carpc::async::timeline::enable( const bool _enabled )
+{
+   SYS_INF( "timeline: %s", _enabled ? "enabled" : "disabled" );
+   __private__::enabled( ).store( _enabled, std::memory_order_relaxed );
+}
+
+std::uint64_t carpc::async::timeline::on_created( )
+{
+   if( false == is_enabled( ) )
+      return 0;
+
+   Buffer* p_buffer = ::buffer( );
+   if( nullptr == p_buffer )
+      return 0;
+
+   const std::uint64_t id = ( static_cast< std::uint64_t >( p_buffer->index ) << s_id_bits ) | ++p_buffer->next_id;
+   p_buffer->write( eStage::CREATE, id, 0, 0 );
+   return id;
+}
+
+void carpc::async::timeline::__private__::record( const eStage stage, const IAsync& async )
+{
+   Buffer* p_buffer = ::buffer( );
+   if( nullptr == p_buffer )
+      return;
+
+   std::uint64_t type = 0;
+   std::uint64_t flow_id = 0;
+   if( const auto& p_signature = async.signature( ) )
+   {
+      const tAsyncTypeID& type_id = p_signature->type_id( );
+      type = type_id.hash( );
+      flow_id = p_signature->flow_id( );
+      // Names are registered once per type and thread, so the global map is locked rarely.
+      if( true == p_buffer->known_types.insert( type ).second )
+      {
+         std::string name = type_id.dbg_name( );
+         std::lock_guard< std::mutex > lock( registry_mutex( ) );
+         type_names( ).emplace( type, std::move( name ) );
+      }
+   }
+
+   p_buffer->write( stage, async.timeline_id( ), type, flow_id );
+}
+
+void carpc::async::timeline::clear( )
+{
+   std::lock_guard< std::mutex > lock( registry_mutex( ) );
+   for( Buffer* p_buffer : registry( ) )
+      p_buffer->cleared.store( p_buffer->head.load( std::memory_order_acquire ), std::memory_order_relaxed );
+}
+
+bool carpc::async::timeline::flush( const std::string& file_name )
+{
+   std::vector< Entry > entries;
+   std::vector< std::pair< std::size_t, std::string > > threads;
+   std::unordered_map< std::uint64_t, std::string > names;
+   {
+      std::lock_guard< std::mutex > lock( registry_mutex( ) );
+      for( const Buffer* p_buffer : registry( ) )
+      {
+         p_buffer->read( entries );
+         threads.emplace_back( p_buffer->index, p_buffer->name );
+      }
+      names = type_names( );
+   }
+   std::stable_sort( entries.begin( ), entries.end( ),
+         []( const Entry& lhs, const Entry& rhs ){ return lhs.time_ns < rhs.time_ns; }
+      );
+
+   std::ofstream file( file_name, std::ios::out | std::ios::trunc );
+   if( false == file.is_open( ) )
+   {
+      SYS_ERR( "unable to open file '%s'", file_name.c_str( ) );
+      return false;
+   }
+
+   // Number of remaining records of each async object and each flow is used for defining
+   // the step of the flow arrow: start, intermediate step or finish.
+   std::unordered_map< std::uint64_t, std::size_t > remaining;
+   std::unordered_map< std::uint64_t, std::size_t > remaining_flows;
+   std::unordered_map< std::uint64_t, std::size_t > started_flows;
+   for( const Entry& entry : entries )
+   {
+      if( eStage::PROCESS_END != entry.stage )
+         ++remaining[ entry.id ];
+      if( 0 != entry.flow_id && ( eStage::DISPATCH == entry.stage || eStage::PROCESS_BEGIN == entry.stage ) )
+         ++remaining_flows[ entry.flow_id ];
+   }
+
+   const long pid = static_cast< long >( getpid( ) );
+   const char* separator = "";
+   char text[ 256 ];
+   auto append = [ & ]( const char* event )
+   {
+      file << separator << event;
+      separator = ",\n";
+   };
+   auto flow = [ & ]( const char* category, const std::uint64_t id, std::size_t& left, const bool first, const double ts, const std::size_t tid )
+   {
+      const char* phase = first ? "s" : ( 0 == --left ? "f" : "t" );
+      if( first )
+         --left;
+      if( first && 0 == left )
+         return;
+      std::snprintf( text, sizeof( text ),
+            "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%s\",\"bp\":\"e\",\"id\":\"0x%lx\",\"ts\":%.3f,\"pid\":%ld,\"tid\":%zu}",
+            category, category, phase, static_cast< unsigned long >( id ), ts, pid, tid
+         );
+      append( text );
+   };
+
+   file << "{\"traceEvents\":[\n";
+   for( const auto& thread : threads )
+   {
+      file << separator
+           << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << thread.first
+           << ",\"args\":{\"name\":\"" << escape( thread.second ) << "\"}}";
+      separator = ",\n";
+   }
+
+   std::unordered_set< std::uint64_t > started;
+   for( const Entry& entry : entries )
+   {
+      const double ts = static_cast< double >( entry.time_ns ) / 1000.0;
+      const auto iterator_name = names.find( entry.type );
+      // Type is not known yet at creation of async object.
+      const std::string name = escape( 0 == entry.type || names.end( ) == iterator_name ? std::string{ "async" } : iterator_name->second );
+
+      switch( entry.stage )
+      {
+         case eStage::PROCESS_BEGIN:
+         case eStage::PROCESS_END:
+         {
+            file << separator
+                 << "{\"name\":\"" << name << "\",\"cat\":\"async\",\"ph\":\""
+                 << ( eStage::PROCESS_BEGIN == entry.stage ? "B" : "E" ) << "\"";
+            break;
+         }
+         default:
+         {
+            file << separator
+                 << "{\"name\":\"" << label( entry.stage ) << " " << name << "\",\"cat\":\"async\",\"ph\":\"X\",\"dur\":0";
+            break;
+         }
+      }
+      std::snprintf( text, sizeof( text ), ",\"ts\":%.3f,\"pid\":%ld,\"tid\":%zu,\"args\":{\"id\":\"0x%lx\"}}",
+            ts, pid, entry.thread, static_cast< unsigned long >( entry.id )
+         );
+      file << text;
+      separator = ",\n";
+
+      // Lifecycle of async object: each stage except the end of processing is linked with the next one.
+      if( eStage::PROCESS_END != entry.stage )
+         flow( "lifecycle", entry.id, remaining[ entry.id ], started.insert( entry.id ).second, ts, entry.thread );
+
+      // Related async objects (request and response): dispatching of each one and start of its processing.
+      if( 0 != entry.flow_id && ( eStage::DISPATCH == entry.stage || eStage::PROCESS_BEGIN == entry.stage ) )
+         flow( "request", entry.flow_id, remaining_flows[ entry.flow_id ], 0 == started_flows[ entry.flow_id ]++, ts, entry.thread );
+   }
+   file << "\n]}\n";
+
+   SYS_INF( "%zu timeline record(s) written to '%s'", entries.size( ), file_name.c_str( ) );
+   return file.good( );
+}
@@ -27,4 +27,42 @@ namespace carpc::async {
       return "unefined";
    }
 
+   const char* c_str( const eAsyncQueueType queue_type )
+   {
+      switch( queue_type )
+      {
+         case eAsyncQueueType::FIFO:         return "carpc::eAsyncQueueType::FIFO";
+         case eAsyncQueueType::PRIORITY:     return "carpc::eAsyncQueueType::PRIORITY";
+         case eAsyncQueueType::LOCK_FREE:    return "carpc::eAsyncQueueType::LOCK_FREE";
+         case eAsyncQueueType::DEADLINE:     return "carpc::eAsyncQueueType::DEADLINE";
+         default:                            return "carpc::eAsyncQueueType::UNEFINED";
+      }
+      return "carpc::eAsyncQueueType::UNEFINED";
+   }
+
+   const char* c_str( const eOverflowPolicy policy )
+   {
+      switch( policy )
+      {
+         case eOverflowPolicy::BLOCK:                 return "carpc::eOverflowPolicy::BLOCK";
+         case eOverflowPolicy::REJECT:                return "carpc::eOverflowPolicy::REJECT";
+         case eOverflowPolicy::DROP_OLDEST:           return "carpc::eOverflowPolicy::DROP_OLDEST";
+         case eOverflowPolicy::DROP_LOWEST_PRIORITY:  return "carpc::eOverflowPolicy::DROP_LOWEST_PRIORITY";
+         default:                                     return "carpc::eOverflowPolicy::UNEFINED";
+      }
+      return "carpc::eOverflowPolicy::UNEFINED";
+   }
+
+   const char* c_str( const eWaitStrategy strategy )
+   {
+      switch( strategy )
+      {
+         case eWaitStrategy::BLOCK:          return "carpc::eWaitStrategy::BLOCK";
+         case eWaitStrategy::SPIN_PARK:      return "carpc::eWaitStrategy::SPIN_PARK";
+         case eWaitStrategy::BUSY_POLL:      return "carpc::eWaitStrategy::BUSY_POLL";
+         default:                            return "carpc::eWaitStrategy::UNEFINED";
+      }
+      return "carpc::eWaitStrategy::UNEFINED";
+   }
+
 }
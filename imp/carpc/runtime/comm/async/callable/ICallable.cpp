@@ -11,6 +11,12 @@ using namespace carpc::async;
 
 const bool ICallable::send( const application::Context& to_context )
 {
+   if( true == to_context.is_internal_broadcast( ) && true == is_single_call( ) )
+   {
+      SYS_ERR( "callable object with move-only arguments can't be broadcasted" );
+      return false;
+   }
+
    return dispatch( to_context );
 }
 
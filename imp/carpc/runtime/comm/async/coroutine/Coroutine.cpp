@@ -0,0 +1,87 @@
+#include "carpc/runtime/comm/async/coroutine/Coroutine.hpp"
+
+#if defined( __cpp_impl_coroutine )
+
+#include <cstddef>
+
+#include "carpc/runtime/application/IThread.hpp"
+#include "carpc/runtime/comm/async/Pool.hpp"
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "Coroutine"
+
+
+
+using namespace carpc::async;
+
+
+
+namespace {
+
+   template< std::size_t SIZE >
+      using tFramePool = pool::TBlockPool< SIZE, alignof( std::max_align_t ) >;
+
+}
+
+
+
+void* carpc::async::coroutine::allocate_frame( const std::size_t size )
+{
+   if( size <= 128 )
+      return tFramePool< 128 >::allocate( );
+   if( size <= 256 )
+      return tFramePool< 256 >::allocate( );
+   if( size <= 512 )
+      return tFramePool< 512 >::allocate( );
+   if( size <= 1024 )
+      return tFramePool< 1024 >::allocate( );
+   if( size <= 2048 )
+      return tFramePool< 2048 >::allocate( );
+
+   return ::operator new( size );
+}
+
+void carpc::async::coroutine::deallocate_frame( void* p_frame, const std::size_t size )
+{
+   if( size <= 128 )
+      return tFramePool< 128 >::deallocate( p_frame );
+   if( size <= 256 )
+      return tFramePool< 256 >::deallocate( p_frame );
+   if( size <= 512 )
+      return tFramePool< 512 >::deallocate( p_frame );
+   if( size <= 1024 )
+      return tFramePool< 1024 >::deallocate( p_frame );
+   if( size <= 2048 )
+      return tFramePool< 2048 >::deallocate( p_frame );
+
+   ::operator delete( p_frame );
+}
+
+
+
+SwitchTo::SwitchTo( const application::Context& to_context )
+   : m_to_context( to_context )
+{
+}
+
+bool SwitchTo::await_ready( ) const
+{
+   // Worker shares context with its application thread, but coroutine must be resumed by the thread itself.
+   return nullptr != application::IThread::current( )
+      && false == application::IThread::is_worker( )
+      && m_to_context.is_internal_local( );
+}
+
+bool SwitchTo::await_suspend( std::coroutine_handle< > handle )
+{
+   auto operation = [ handle ]( ) { handle.resume( ); };
+   if( true == Runnable::create( operation )->send( m_to_context ) )
+      return true;
+
+   SYS_ERR( "coroutine can't be switched to context '%s'", m_to_context.dbg_name( ).c_str( ) );
+   m_result = false;
+   return false;
+}
+
+#endif // __cpp_impl_coroutine
@@ -2,6 +2,7 @@
 #include "carpc/runtime/comm/async/event/IEvent.hpp"
 
 #include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
 #define CLASS_ABBR "IEvent"
 
 
@@ -27,7 +28,7 @@ void IEvent::dump( )
 {
    for( auto& pair : s_registry )
    {
-      SYS_VRB( "name: %s / creator: %p", pair.first.c_str( ), pair.second );
+      RT_VRB( "name: %s / creator: %p", pair.first.c_str( ), pair.second );
    }
 }
 
@@ -99,14 +100,20 @@ const bool IEvent::from_stream( ipc::tStream& stream )
 
 const bool IEvent::set_notification( IAsync::IConsumer* p_consumer, const ISignature::tSptr p_signature )
 {
-   application::IThread::tSptr p_thread = application::Process::instance( )->current_thread( );
+   application::IThread::tRptr p_thread = application::IThread::current( );
    if( nullptr == p_thread )
    {
       SYS_ERR( "subscribe on event not from application thread" );
       return false;
    }
+   // Notifications of application thread are accessed only by its own os thread.
+   if( true == application::IThread::is_worker( ) )
+   {
+      SYS_ERR( "subscribe on event from worker of application thread '%s'", p_thread->name( ).c_str( ) );
+      return false;
+   }
 
-   SYS_INF( "event: %s / consumer: %p / application thread: %s", p_signature->dbg_name( ).c_str( ), p_consumer, p_thread->name( ).c_str( ) );
+   RT_DBG( "event: %s / consumer: %p / application thread: %s", p_signature->dbg_name( ).c_str( ), p_consumer, p_thread->name( ).c_str( ) );
    p_thread->set_notification( p_signature, p_consumer );
 
    return true;
@@ -114,14 +121,20 @@ const bool IEvent::set_notification( IAsync::IConsumer* p_consumer, const ISigna
 
 const bool IEvent::clear_notification( IAsync::IConsumer* p_consumer, const ISignature::tSptr p_signature )
 {
-   application::IThread::tSptr p_thread = application::Process::instance( )->current_thread( );
+   application::IThread::tRptr p_thread = application::IThread::current( );
    if( nullptr == p_thread )
    {
       SYS_ERR( "unsubscribe from event not from application thread" );
       return false;
    }
+   // Notifications of application thread are accessed only by its own os thread.
+   if( true == application::IThread::is_worker( ) )
+   {
+      SYS_ERR( "unsubscribe from event from worker of application thread '%s'", p_thread->name( ).c_str( ) );
+      return false;
+   }
 
-   SYS_INF( "event: %s / consumer: %p / application thread: %s", p_signature->dbg_name( ).c_str( ), p_consumer, p_thread->name( ).c_str( ) );
+   RT_DBG( "event: %s / consumer: %p / application thread: %s", p_signature->dbg_name( ).c_str( ), p_consumer, p_thread->name( ).c_str( ) );
    p_thread->clear_notification( p_signature, p_consumer );
 
    return true;
@@ -129,14 +142,20 @@ const bool IEvent::clear_notification( IAsync::IConsumer* p_consumer, const ISig
 
 const bool IEvent::clear_all_notifications( IAsync::IConsumer* p_consumer, const ISignature::tSptr p_signature )
 {
-   application::IThread::tSptr p_thread = application::Process::instance( )->current_thread( );
+   application::IThread::tRptr p_thread = application::IThread::current( );
    if( nullptr == p_thread )
    {
       SYS_ERR( "unsubscribe from event not from application thread" );
       return false;
    }
+   // Notifications of application thread are accessed only by its own os thread.
+   if( true == application::IThread::is_worker( ) )
+   {
+      SYS_ERR( "unsubscribe from event from worker of application thread '%s'", p_thread->name( ).c_str( ) );
+      return false;
+   }
 
-   SYS_INF( "event: %s / consumer: %p / application thread: %s", p_signature->dbg_name( ).c_str( ), p_consumer, p_thread->name( ).c_str( ) );
+   RT_DBG( "event: %s / consumer: %p / application thread: %s", p_signature->dbg_name( ).c_str( ), p_consumer, p_thread->name( ).c_str( ) );
    p_thread->clear_all_notifications( p_signature, p_consumer );
 
    return true;
@@ -155,6 +174,6 @@ void IEvent::process( IAsync::IConsumer* p_consumer ) const
       return;
    }
 
-   SYS_INF( "consumer: %p", p_consumer );
+   RT_VRB( "consumer: %p", p_consumer );
    process_event( p_consumer );
 }
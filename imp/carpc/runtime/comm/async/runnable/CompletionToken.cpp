@@ -0,0 +1,61 @@
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "carpc/runtime/common/CpuRelax.hpp"
+#include "carpc/runtime/comm/async/runnable/CompletionToken.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#define CLASS_ABBR "CompletionToken"
+
+
+
+using namespace carpc::async;
+
+
+
+namespace {
+
+   // Number of spin iterations before going to sleep. Synchronous calls to other thread are
+   // usually short, so there is a chance to get the result without syscall.
+   const std::size_t s_spin_count = 256;
+
+   long futex( std::atomic< std::uint32_t >& state, const int operation, const std::uint32_t value )
+   {
+      return syscall( SYS_futex, reinterpret_cast< std::uint32_t* >( &state ), operation | FUTEX_PRIVATE_FLAG, value, nullptr, nullptr, 0 );
+   }
+
+}
+
+
+
+void CompletionToken::wait( )
+{
+   for( std::size_t count = 0; count < s_spin_count; ++count )
+   {
+      if( is_completed( ) )
+         return;
+      cpu_relax( );
+   }
+
+   std::uint32_t state = PENDING;
+   if( false == m_state.compare_exchange_strong( state, WAITING, std::memory_order_acquire ) )
+   {
+      if( COMPLETED == state )
+         return;
+   }
+
+   // Futex returns immediately in case if state is not 'WAITING' any more and could be woken up
+   // spuriously, so state is checked in the loop.
+   while( false == is_completed( ) )
+      futex( m_state, FUTEX_WAIT, WAITING );
+}
+
+void CompletionToken::notify( )
+{
+   // Token must not be accessed after exchange, because waiting thread could already destroy it.
+   // Private futex wake uses only address as the key and does not access the memory.
+   std::atomic< std::uint32_t >* p_state = &m_state;
+   if( WAITING == p_state->exchange( COMPLETED, std::memory_order_release ) )
+      futex( *p_state, FUTEX_WAKE, 1 );
+}
@@ -1,5 +1,6 @@
 #include "carpc/runtime/application/Process.hpp"
 #include "carpc/runtime/comm/async/runnable/IRunnable.hpp"
+#include "carpc/runtime/comm/async/runnable/CompletionToken.hpp"
 
 #include "carpc/trace/Trace.hpp"
 #define CLASS_ABBR "IRunnable"
@@ -26,25 +27,22 @@ const bool IRunnable::send( const application::Context& to_context, const bool i
    }
 
    // Sending blocking Async object
-   std::shared_ptr<carpc::os::ConditionVariable> p_cond_var = std::make_shared<carpc::os::ConditionVariable>();
-
-
-   auto operation_wrapper = [ operation = m_operation, p_cond_var ]( )
+   // Completion token is located on the stack of current thread and is alive till the end of waiting.
+   CompletionToken token;
+   auto operation_wrapper = [ operation = std::move( m_operation ), p_token = &token ]( )
    {
       if( operation )
          operation( );
 
-      p_cond_var->notify( );
+      p_token->notify( );
    };
 
-   m_operation = operation_wrapper;
+   m_operation = std::move( operation_wrapper );
 
    if( false == dispatch( to_context ) )
       return false;
 
-   while ( true != p_cond_var->test( ) )
-      p_cond_var->wait( );
-
+   token.wait( );
    return true;
 }
 
@@ -0,0 +1,115 @@
+#include <atomic>
+
+#include "carpc/runtime/application/IThread.hpp"
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+#include "carpc/runtime/comm/async/runnable/Parallel.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
+#define CLASS_ABBR "Parallel"
+
+
+
+using namespace carpc::async;
+
+
+
+namespace {
+
+   // State shared by all operations of one 'when_all' call.
+   struct Join
+   {
+      Join( const std::size_t _remaining, tContinuation&& _continuation, const bool _has_caller )
+         : remaining( _remaining )
+         , continuation( std::move( _continuation ) )
+         , has_caller( _has_caller )
+      { }
+
+      std::atomic< std::size_t >       remaining;
+      std::atomic< bool >              result = true;
+      tContinuation                    continuation;
+      const bool                       has_caller;
+      carpc::application::Context      caller = carpc::application::Context::current( );
+   };
+
+   void finish( const std::shared_ptr< Join >& p_join )
+   {
+      if( false == p_join->has_caller )
+      {
+         if( p_join->continuation )
+            p_join->continuation( p_join->result.load( ) );
+         return;
+      }
+
+      auto operation = [ p_join ]( )
+      {
+         if( p_join->continuation )
+            p_join->continuation( p_join->result.load( ) );
+      };
+      if( false == Runnable::create( operation )->send( p_join->caller ) )
+      {
+         SYS_ERR( "continuation can't be sent to '%s'", p_join->caller.dbg_name( ).c_str( ) );
+      }
+   }
+
+   void complete( const std::shared_ptr< Join >& p_join )
+   {
+      if( 1 == p_join->remaining.fetch_sub( 1, std::memory_order_acq_rel ) )
+         finish( p_join );
+   }
+
+}
+
+
+
+const bool carpc::async::when_all( std::vector< IRunnable::tOperation > operations, tContinuation continuation, const tContexts& contexts )
+{
+   const bool has_caller = nullptr != application::IThread::current( );
+   auto p_join = std::make_shared< Join >( operations.size( ), std::move( continuation ), has_caller );
+   if( true == operations.empty( ) )
+   {
+      finish( p_join );
+      return true;
+   }
+
+   tContexts current_context;
+   if( true == contexts.empty( ) )
+      current_context.push_back( p_join->caller );
+   const tContexts& destinations = contexts.empty( ) ? current_context : contexts;
+   // Each operation must be executed exactly once in current process, otherwise 'remaining' counter
+   // would not match number of completed operations.
+   for( const auto& context : destinations )
+   {
+      if( true == context.is_internal_broadcast( ) || true == context.is_external( ) )
+      {
+         SYS_ERR( "operations can't be sent to broadcast or external context '%s'", context.dbg_name( ).c_str( ) );
+         p_join->result.store( false );
+         finish( p_join );
+         return false;
+      }
+   }
+   RT_VRB( "sending %zu operation(s) to %zu context(s)", operations.size( ), destinations.size( ) );
+
+   bool result = true;
+   for( std::size_t index = 0; index < operations.size( ); ++index )
+   {
+      auto operation = [ p_join, operation = std::move( operations[ index ] ) ]( )
+      {
+         if( operation )
+            operation( );
+         complete( p_join );
+      };
+
+      IRunnable::tSptr p_runnable = Runnable::create( std::move( operation ) );
+      p_runnable->concurrent( true );
+      if( false == p_runnable->send( destinations[ index % destinations.size( ) ] ) )
+      {
+         SYS_ERR( "operation can't be sent to '%s'", destinations[ index % destinations.size( ) ].dbg_name( ).c_str( ) );
+         p_join->result.store( false );
+         result = false;
+         complete( p_join );
+      }
+   }
+
+   return result;
+}
@@ -1,4 +1,5 @@
 #include "carpc/oswrappers/ConditionVariable.hpp"
+#include "carpc/runtime/application/IThread.hpp"
 #include "carpc/runtime/comm/async/runnable/Runnable.hpp"
 
 #include "carpc/trace/Trace.hpp"
@@ -9,9 +10,9 @@ using namespace carpc::async;
 
 
 
-Runnable::tSptr Runnable::create( const tOperation operation )
+Runnable::tSptr Runnable::create( const tOperation operation, const tDeadline& deadline )
 {
-   return std::shared_ptr< Runnable >( new Runnable( operation ) );
+   return make_async< Runnable >( operation, deadline );
 }
 
 const bool Runnable::create_send( const tOperation operation, const application::Context& to_context, const bool is_block )
@@ -28,3 +29,32 @@ const bool Runnable::create_send( const tOperation operation, const application:
 
    return create( operation )->send( to_context, is_block );
 }
+
+bool Runnable::is_current( const application::Context& to_context, bool& is_valid )
+{
+   is_valid = true;
+   if( application::thread::broadcast == to_context.tid( ) )
+   {
+      SYS_ERR( "synchronous call can't be done to broadcast context '%s'", to_context.dbg_name( ).c_str( ) );
+      is_valid = false;
+      return false;
+   }
+
+   // Calls from not application threads are always sent
+   if( nullptr == application::IThread::current( ) )
+      return false;
+
+   if( false == to_context.is_internal_local( ) )
+      return false;
+
+   // Worker can't execute function of owner thread and can't wait for owner thread, because
+   // owner thread could wait for its workers.
+   if( true == application::IThread::is_worker( ) )
+   {
+      SYS_ERR( "synchronous call can't be done from worker to its application thread" );
+      is_valid = false;
+      return false;
+   }
+
+   return true;
+}
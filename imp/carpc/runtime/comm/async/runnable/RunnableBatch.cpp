@@ -0,0 +1,48 @@
+#include "carpc/runtime/comm/async/runnable/RunnableBatch.hpp"
+
+#include "carpc/trace/Trace.hpp"
+#include "carpc/runtime/common/Trace.hpp"
+#define CLASS_ABBR "RunnableBatch"
+
+
+using namespace carpc::async;
+
+
+
+RunnableBatch::RunnableBatch( const std::size_t reserve, const tDeadline& deadline )
+   : IRunnable( nullptr, { }, deadline )
+{
+   m_operations.reserve( reserve );
+}
+
+RunnableBatch::tSptr RunnableBatch::create( const std::size_t reserve, const tDeadline& deadline )
+{
+   return make_async< RunnableBatch >( reserve, deadline );
+}
+
+const bool RunnableBatch::create_send( tOperations operations, const application::Context& to_context, const bool is_block )
+{
+   if( true == operations.empty( ) )
+   {
+      SYS_WRN( "sending empty batch of runnable objects" );
+      return true;
+   }
+
+   tSptr p_batch = create( );
+   p_batch->m_operations = std::move( operations );
+   return p_batch->send( to_context, is_block );
+}
+
+void RunnableBatch::process( IAsync::IConsumer* p_consumer ) const
+{
+   RT_VRB( "processing %zu operation(s)", m_operations.size( ) );
+   for( const auto& operation : m_operations )
+   {
+      if( operation )
+         operation( );
+   }
+
+   // Operation of base runnable is set only by blocking sending and notifies the sender,
+   // so it must be executed after all operations of the batch.
+   IRunnable::process( p_consumer );
+}
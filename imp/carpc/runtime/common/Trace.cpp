@@ -0,0 +1,9 @@
+#include "carpc/runtime/common/Trace.hpp"
+
+
+
+std::atomic< carpc::runtime::trace::eLevel >& carpc::runtime::trace::__private__::level( )
+{
+   static std::atomic< eLevel > s_level{ static_cast< eLevel >( CARPC_RUNTIME_TRACE_LEVEL ) };
+   return s_level;
+}
@@ -0,0 +1,127 @@
+#include <cstdlib>
+
+#include "carpc/runtime/application/main.hpp"
+#include "carpc/runtime/application/RootComponent.hpp"
+#include "carpc/runtime/comm/async/event/Event.hpp"
+#include "carpc/runtime/comm/async/runnable/Runnable.hpp"
+
+
+
+/****************************************************************************************************
+ *
+ * Runtime tests what require running application.
+ * Tests are executed by 'Test' thread what has workers for concurrent async objects.
+ * In case of failure error is printed and process exits with failure code, otherwise application
+ * is shut down after all checks are passed.
+ *
+ ***************************************************************************************************/
+namespace runtime_test {
+
+   DEFINE_EVENT( Probe, std::size_t, carpc::async::id::TSignature< std::size_t > );
+
+   class Test
+      : public carpc::application::RootComponent
+      , public Probe::Consumer
+   {
+      public:
+         static carpc::application::IComponent::tSptr creator( )
+         {
+            return std::shared_ptr< Test >( new Test( "Test" ) );
+         }
+
+      private:
+         Test( const std::string& name ) : RootComponent( name ) { }
+      public:
+         ~Test( ) override = default;
+
+      private:
+         void process_boot( const std::string& ) override;
+         void process_event( const Probe::Event& ) override;
+
+      private:
+         static void check( const bool condition, const char* const description );
+
+      private:
+         // Worker of application thread must not subscribe on events: notifications are accessed
+         // only by os thread of application thread.
+         void workers_subscribe( );
+         void workers_subscribe_finish( const bool is_worker, const bool is_subscribed );
+         static constexpr std::size_t s_workers_subscribe = 1;
+   };
+
+
+
+   void Test::process_boot( const std::string& )
+   {
+      workers_subscribe( );
+   }
+
+   void Test::process_event( const Probe::Event& event )
+   {
+      check( s_workers_subscribe == event.info( ).id( ), "event is delivered to subscription of application thread" );
+      check( false == carpc::application::IThread::is_worker( ), "event is processed by application thread" );
+      Probe::Event::clear_all_notifications( this );
+
+      MSG_INF( "all tests passed" );
+      shutdown( );
+   }
+
+   void Test::check( const bool condition, const char* const description )
+   {
+      if( condition )
+      {
+         MSG_INF( "passed: %s", description );
+         return;
+      }
+
+      MSG_ERR( "failed: %s", description );
+      std::quick_exit( EXIT_FAILURE );
+   }
+
+   void Test::workers_subscribe( )
+   {
+      auto operation = [ this ]( )
+      {
+         const bool is_worker = carpc::application::IThread::is_worker( );
+         const bool is_subscribed = Probe::Event::set_notification( this, s_workers_subscribe );
+         // Runnable object sent from worker to local context is delivered to application thread.
+         carpc::async::Runnable::create_send(
+               [ this, is_worker, is_subscribed ]( ){ workers_subscribe_finish( is_worker, is_subscribed ); }
+            );
+      };
+
+      carpc::async::IRunnable::tSptr p_runnable = carpc::async::Runnable::create( operation );
+      p_runnable->concurrent( true );
+      check( p_runnable->send( ), "concurrent runnable object is sent" );
+   }
+
+   void Test::workers_subscribe_finish( const bool is_worker, const bool is_subscribed )
+   {
+      check( true == is_worker, "concurrent runnable object is processed by worker" );
+      check( false == is_subscribed, "subscription from worker is rejected" );
+      check( false == carpc::application::IThread::is_worker( ), "runnable object from worker is processed by application thread" );
+      check( true == Probe::Event::set_notification( this, s_workers_subscribe ), "subscription from application thread is accepted" );
+      check( true == Probe::Event::create( s_workers_subscribe )->data( 0 )->send( ), "event is sent" );
+   }
+
+} // namespace runtime_test
+
+
+
+namespace {
+
+   carpc::application::Thread::Configuration configuration( )
+   {
+      carpc::application::Thread::Configuration configuration{ "Test", { runtime_test::Test::creator }, 0 };
+      configuration.m_workers = 2;
+      return configuration;
+   }
+
+}
+
+const carpc::application::Thread::Configuration::tVector services = { configuration( ) };
+
+bool test( int argc, char** argv, char** envp )
+{
+   return true;
+}